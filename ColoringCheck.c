@@ -0,0 +1,735 @@
+#include <stdio.h>   // Para entrada/saída (printf, fprintf)
+#include <stdlib.h>  // Para alocação de memória (malloc, calloc, free, exit)
+#include <limits.h>  // Para LLONG_MAX
+#include <string.h>  // Para memcpy
+
+#include "graph.h"    // Grafo e montagem a partir de arestas
+#include "coloring.h" // Algoritmos de coloração
+
+// --- Verificação de Regressão das Colorações ---
+// Os núcleos da biblioteca (heaps, contadores incrementais, matrizes de bits) prometem a mesma
+// coloração das varreduras originais, vértice a vértice. Este programa compara cada um deles com
+// uma implementação de referência, escrita como as varreduras O(n^2) originais (só com
+// graph_has_edge), em grafos fixos gerados com semente e nas três representações. Os que não têm
+// uma varredura a reproduzir são conferidos por propriedades (validade, limites).
+// Uso: make check (ou ./ColoringCheck). Sai com erro se alguma coloração diferir.
+
+// Gerador xorshift64: os grafos são os mesmos em qualquer máquina
+static uint64_t check_rng_state;
+
+static double check_random(void) {
+    check_rng_state ^= check_rng_state << 13;
+    check_rng_state ^= check_rng_state >> 7;
+    check_rng_state ^= check_rng_state << 17;
+    return (check_rng_state >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Grafo aleatório G(n, p) com semente fixa. Com p alto, vários vértices empatam em grau e os
+// desempates (grau, índice) são exercitados.
+static Graph *check_random_graph(int n, double p, uint64_t seed) {
+    check_rng_state = seed;
+    Graph *graph = graph_create(n, 0);
+    EdgeBuffer buffer = { 0 };
+    if (graph == NULL) {
+        perror("Erro ao alocar memória para o grafo de teste");
+        exit(EXIT_FAILURE);
+    }
+    for (int u = 0; u < n; u++) {
+        for (int v = u + 1; v < n; v++) {
+            if (check_random() < p && !edge_buffer_push(&buffer, u, v)) {
+                exit(EXIT_FAILURE);
+            }
+        }
+    }
+    if (!build_graph_from_edges(graph, &buffer, 1, NULL)) {
+        exit(EXIT_FAILURE);
+    }
+    return graph;
+}
+
+// Vértice não colorido de maior chave; empates pelo maior grau e depois pelo menor índice
+// (a varredura em ordem de índice só troca de candidato com desigualdade estrita).
+static int reference_pick(int n, const bool *skip, const int *key, const int *degree) {
+    int best = -1;
+    for (int v = 0; v < n; v++) {
+        if (skip[v]) continue;
+        if (best < 0 || key[v] > key[best] || (key[v] == key[best] && degree[v] > degree[best])) {
+            best = v;
+        }
+    }
+    return best;
+}
+
+// calloc que encerra o programa se faltar memória
+static void *reference_calloc(size_t count, size_t size) {
+    void *p = calloc(count > 0 ? count : 1, size);
+    if (p == NULL) {
+        perror("Erro ao alocar memória na referência");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+// Menor cor que nenhum vizinho colorido de v usa
+static int reference_first_fit(Graph *graph, const int *colors, int v) {
+    int n = graph->num_vertices;
+    bool *used = (bool *)reference_calloc(n + 2, sizeof(bool));
+    for (int u = 0; u < n; u++) {
+        if (colors[u] != 0 && graph_has_edge(graph, v, u)) {
+            used[colors[u]] = true;
+        }
+    }
+    int c = 1;
+    while (used[c]) {
+        c++;
+    }
+    free(used);
+    return c;
+}
+
+static int *reference_degrees(Graph *graph) {
+    int n = graph->num_vertices;
+    int *degree = (int *)reference_calloc(n, sizeof(int));
+    for (int v = 0; v < n; v++) {
+        for (int u = 0; u < n; u++) {
+            degree[v] += graph_has_edge(graph, v, u);
+        }
+    }
+    return degree;
+}
+
+// LDO: First Fit na ordem decrescente de grau, índices crescentes no empate
+static int reference_ldo(Graph *graph, int *colors) {
+    int n = graph->num_vertices;
+    int *degree = reference_degrees(graph);
+    bool *done = (bool *)reference_calloc(n, sizeof(bool));
+    int *zero = (int *)reference_calloc(n, sizeof(int));
+    int max_color = 0;
+    for (int v = 0; v < n; v++) {
+        colors[v] = 0;
+    }
+    for (int i = 0; i < n; i++) {
+        int v = reference_pick(n, done, zero, degree);
+        done[v] = true;
+        colors[v] = reference_first_fit(graph, colors, v);
+        if (colors[v] > max_color) max_color = colors[v];
+    }
+    free(degree);
+    free(done);
+    free(zero);
+    return max_color;
+}
+
+// Welsh-Powell: a cada cor, percorre os não coloridos em ordem decrescente de grau (índices
+// crescentes no empate) e põe na classe cada um que não tem vizinho nela
+static int reference_welsh_powell(Graph *graph, int *colors) {
+    int n = graph->num_vertices;
+    int *degree = reference_degrees(graph);
+    bool *placed = (bool *)reference_calloc(n, sizeof(bool));
+    int *zero = (int *)reference_calloc(n, sizeof(int));
+    int *order = (int *)reference_calloc(n, sizeof(int));
+    for (int i = 0; i < n; i++) {
+        order[i] = reference_pick(n, placed, zero, degree);
+        placed[order[i]] = true;
+    }
+    for (int v = 0; v < n; v++) {
+        colors[v] = 0;
+    }
+    int color = 0;
+    int colored_count = 0;
+    while (colored_count < n) {
+        color++;
+        for (int i = 0; i < n; i++) {
+            int v = order[i];
+            if (colors[v] != 0) continue;
+            bool admissible = true;
+            for (int u = 0; u < n && admissible; u++) {
+                admissible = !(colors[u] == color && graph_has_edge(graph, v, u));
+            }
+            if (admissible) {
+                colors[v] = color;
+                colored_count++;
+            }
+        }
+    }
+    free(degree);
+    free(placed);
+    free(zero);
+    free(order);
+    return color;
+}
+
+// IDO: maior número de vizinhos coloridos
+static int reference_ido(Graph *graph, int *colors) {
+    int n = graph->num_vertices;
+    int *degree = reference_degrees(graph);
+    bool *done = (bool *)reference_calloc(n, sizeof(bool));
+    int *incidence = (int *)reference_calloc(n, sizeof(int));
+    int max_color = 0;
+    for (int v = 0; v < n; v++) {
+        colors[v] = 0;
+    }
+    for (int i = 0; i < n; i++) {
+        for (int v = 0; v < n; v++) {
+            incidence[v] = 0;
+            for (int u = 0; u < n; u++) {
+                incidence[v] += done[u] && graph_has_edge(graph, v, u);
+            }
+        }
+        int v = reference_pick(n, done, incidence, degree);
+        done[v] = true;
+        colors[v] = reference_first_fit(graph, colors, v);
+        if (colors[v] > max_color) max_color = colors[v];
+    }
+    free(degree);
+    free(done);
+    free(incidence);
+    return max_color;
+}
+
+// DSATUR: maior número de cores distintas entre os vizinhos coloridos
+static int reference_dsatur(Graph *graph, int *colors) {
+    int n = graph->num_vertices;
+    int *degree = reference_degrees(graph);
+    bool *done = (bool *)reference_calloc(n, sizeof(bool));
+    int *saturation = (int *)reference_calloc(n, sizeof(int));
+    bool *seen = (bool *)reference_calloc(n + 2, sizeof(bool));
+    int max_color = 0;
+    for (int v = 0; v < n; v++) {
+        colors[v] = 0;
+    }
+    for (int i = 0; i < n; i++) {
+        for (int v = 0; v < n; v++) {
+            saturation[v] = 0;
+            for (int c = 0; c <= n + 1; c++) {
+                seen[c] = false;
+            }
+            for (int u = 0; u < n; u++) {
+                if (colors[u] != 0 && graph_has_edge(graph, v, u) && !seen[colors[u]]) {
+                    seen[colors[u]] = true;
+                    saturation[v]++;
+                }
+            }
+        }
+        int v = reference_pick(n, done, saturation, degree);
+        done[v] = true;
+        colors[v] = reference_first_fit(graph, colors, v);
+        if (colors[v] > max_color) max_color = colors[v];
+    }
+    free(degree);
+    free(done);
+    free(saturation);
+    free(seen);
+    return max_color;
+}
+
+// RLF: cada cor começa pelo não colorido de maior grau e cresce pelo candidato (não colorido,
+// fora de U) com mais vizinhos em U, onde U são os vizinhos, coloridos ou não, da classe
+static int reference_rlf(Graph *graph, int *colors) {
+    int n = graph->num_vertices;
+    int *degree = reference_degrees(graph);
+    bool *skip = (bool *)reference_calloc(n, sizeof(bool));
+    bool *in_U = (bool *)reference_calloc(n, sizeof(bool));
+    int *neighbors_in_U = (int *)reference_calloc(n, sizeof(int));
+    int color = 0;
+    int colored_count = 0;
+    for (int v = 0; v < n; v++) {
+        colors[v] = 0;
+    }
+    while (colored_count < n) {
+        color++;
+        for (int u = 0; u < n; u++) {
+            in_U[u] = false;
+        }
+        while (true) {
+            for (int y = 0; y < n; y++) {
+                skip[y] = colors[y] != 0 || in_U[y];
+                neighbors_in_U[y] = 0;
+                for (int u = 0; u < n; u++) {
+                    neighbors_in_U[y] += in_U[u] && graph_has_edge(graph, y, u);
+                }
+            }
+            int v = reference_pick(n, skip, neighbors_in_U, degree);
+            if (v < 0) break;
+            colors[v] = color;
+            colored_count++;
+            for (int u = 0; u < n; u++) {
+                if (graph_has_edge(graph, v, u)) in_U[u] = true;
+            }
+        }
+    }
+    free(degree);
+    free(skip);
+    free(in_U);
+    free(neighbors_in_U);
+    return color;
+}
+
+// --- Execução ---
+
+typedef int (*ColoringFn)(Graph *graph, int *colors);
+
+typedef struct {
+    const char *name;
+    ColoringFn kernel;    // Implementação da biblioteca
+    ColoringFn reference; // Varredura original
+} CheckedAlgorithm;
+
+static const CheckedAlgorithm checked_algorithms[] = {
+    { "WP", welsh_powell_coloring, reference_welsh_powell },
+    { "LDO", largest_degree_ordering_coloring, reference_ldo },
+    { "IDO", incidence_degree_ordering_coloring, reference_ido },
+    { "DSATUR", dsatur_coloring, reference_dsatur },
+    { "RLF", recursive_largest_first_coloring, reference_rlf },
+};
+
+// --- Propriedades ---
+// Algoritmos sem varredura de referência a reproduzir vértice a vértice. Cada verificação roda
+// num grafo (em cada representação) e retorna NULL, ou a descrição da falha.
+
+typedef const char *(*PropertyFn)(Graph *graph);
+
+typedef struct {
+    const char *name;
+    PropertyFn check;
+} CheckedProperty;
+
+static char failure_text[128]; // Descrição de falha montada com snprintf
+
+static int *property_colors(Graph *graph) {
+    return (int *)reference_calloc(graph->num_vertices, sizeof(int));
+}
+
+// IDO com fila de baldes: só o desempate por grau é aproximado, então a coloração tem de ser
+// válida, com no máximo grau máximo + 1 cores, e perto da do modo exato (folga de 1 + 10%).
+static const char *check_ido_bucket(Graph *graph) {
+    int *colors = property_colors(graph);
+    int *exact = property_colors(graph);
+    int num_colors = incidence_degree_ordering_coloring_mode(graph, colors, IDO_TIES_BUCKET);
+    int exact_colors = incidence_degree_ordering_coloring_mode(graph, exact, IDO_TIES_EXACT);
+    const char *failure = NULL;
+    if (!coloring_is_valid(graph, colors)) {
+        failure = "coloração inválida";
+    } else if (num_colors > graph_max_degree(graph) + 1) {
+        failure = "mais cores que grau máximo + 1";
+    } else if (num_colors > exact_colors + 1 + exact_colors / 10) {
+        failure = "muito mais cores que o modo exato";
+    }
+    free(colors);
+    free(exact);
+    return failure;
+}
+
+#define CHECK_SEED 12345 // Semente dos algoritmos aleatórios
+
+// Jones-Plassmann: a coloração depende só da semente. Com 1, 2 e 4 threads tem de ser a mesma, e
+// igual ao First Fit sequencial na ordem de prioridade decrescente.
+static const char *check_jones_plassmann(Graph *graph) {
+    int n = graph->num_vertices;
+    int *order = property_colors(graph);
+    int *expected = property_colors(graph);
+    int *colors = property_colors(graph);
+    jones_plassmann_order(graph, CHECK_SEED, order);
+    int expected_colors = greedy_coloring_in_order(graph, order, expected);
+    const char *failure = NULL;
+    const int thread_counts[] = { 1, 2, 4 };
+    for (int t = 0; t < 3 && failure == NULL; t++) {
+        int num_colors = jones_plassmann_coloring(graph, colors, thread_counts[t], CHECK_SEED);
+        bool same = num_colors == expected_colors;
+        for (int v = 0; v < n && same; v++) {
+            same = colors[v] == expected[v];
+        }
+        if (!same) {
+            snprintf(failure_text, sizeof(failure_text), "%d thread(s) diferem do First Fit na ordem de prioridade",
+                     thread_counts[t]);
+            failure = failure_text;
+        }
+    }
+    free(order);
+    free(expected);
+    free(colors);
+    return failure;
+}
+
+// Gebremedhin-Manne: com uma thread não há conflitos, e o resultado é o First Fit na mesma ordem
+// (a natural e a de grau); com várias, depende da intercalação, mas tem de ser válido.
+static const char *check_speculative_greedy(Graph *graph) {
+    int n = graph->num_vertices;
+    int *expected = property_colors(graph);
+    int *colors = property_colors(graph);
+    const int *orders[] = { NULL, graph_degree_order(graph) };
+    const char *failure = NULL;
+    for (int o = 0; o < 2 && failure == NULL; o++) {
+        int expected_colors = greedy_coloring_in_order(graph, orders[o], expected);
+        int num_colors = speculative_greedy_coloring(graph, orders[o], colors, 1);
+        bool same = num_colors == expected_colors;
+        for (int v = 0; v < n && same; v++) {
+            same = colors[v] == expected[v];
+        }
+        if (!same) {
+            failure = o == 0 ? "1 thread difere do First Fit na ordem natural"
+                             : "1 thread difere do First Fit na ordem de grau";
+        }
+    }
+    for (int threads = 2; threads <= 4 && failure == NULL; threads *= 2) {
+        int num_colors = speculative_greedy_coloring(graph, NULL, colors, threads);
+        if (!coloring_is_valid(graph, colors) || num_colors > graph_max_degree(graph) + 1) {
+            snprintf(failure_text, sizeof(failure_text), "coloração inválida com %d threads", threads);
+            failure = failure_text;
+        }
+    }
+    free(expected);
+    free(colors);
+    return failure;
+}
+
+// --- Melhoria de Colorações ---
+// Buscas por tempo de parede: o resultado varia com a máquina, mas nunca pode ser inválido nem
+// pior que a coloração de partida. Prazo curto, para caber no make check.
+
+#define IMPROVEMENT_TIME_LIMIT 0.02 // Segundos por execução
+
+// Maior cor usada: o número de cores que a função de melhoria tem de retornar
+static int property_max_color(Graph *graph, const int *colors) {
+    int max_color = 0;
+    for (int v = 0; v < graph->num_vertices; v++) {
+        if (colors[v] > max_color) max_color = colors[v];
+    }
+    return max_color;
+}
+
+// Confere o resultado de uma melhoria que partiu de start_colors cores
+static const char *check_improved(Graph *graph, const int *colors, int num_colors, int start_colors) {
+    if (!coloring_is_valid(graph, colors)) {
+        return "coloração inválida";
+    }
+    if (num_colors != property_max_color(graph, colors)) {
+        return "número de cores retornado difere da coloração";
+    }
+    if (num_colors > start_colors) {
+        snprintf(failure_text, sizeof(failure_text), "%d cores, mais que as %d da partida", num_colors, start_colors);
+        return failure_text;
+    }
+    return NULL;
+}
+
+// Iterated Greedy a partir do DSATUR
+static const char *check_iterated_greedy(Graph *graph) {
+    int *colors = property_colors(graph);
+    int start_colors = dsatur_coloring(graph, colors);
+    int num_colors = iterated_greedy_coloring(graph, colors, IMPROVEMENT_TIME_LIMIT, CHECK_SEED);
+    const char *failure = check_improved(graph, colors, num_colors, start_colors);
+    free(colors);
+    return failure;
+}
+
+// TabuCol a partir do DSATUR; time_to_k só pode marcar as k entre o resultado e a partida
+static const char *check_tabucol(Graph *graph) {
+    int *colors = property_colors(graph);
+    int start_colors = dsatur_coloring(graph, colors);
+    double *time_to_k = (double *)reference_calloc(start_colors + 1, sizeof(double));
+    int num_colors = tabucol_coloring(graph, colors, IMPROVEMENT_TIME_LIMIT, CHECK_SEED, time_to_k);
+    const char *failure = check_improved(graph, colors, num_colors, start_colors);
+    for (int k = 1; k < start_colors && failure == NULL; k++) {
+        if ((time_to_k[k] >= 0) != (k >= num_colors)) {
+            snprintf(failure_text, sizeof(failure_text), "time_to_k[%d] = %.3f com %d cores", k, time_to_k[k],
+                     num_colors);
+            failure = failure_text;
+        }
+    }
+    free(time_to_k);
+    free(colors);
+    return failure;
+}
+
+// Algoritmo evolutivo a partir do DSATUR, com uma thread e com duas trocando indivíduos
+static const char *check_hybrid_evolutionary(Graph *graph) {
+    int *start = property_colors(graph);
+    int *colors = property_colors(graph);
+    int start_colors = dsatur_coloring(graph, start);
+    const char *failure = NULL;
+    for (int threads = 1; threads <= 2 && failure == NULL; threads++) {
+        memcpy(colors, start, graph->num_vertices * sizeof(int));
+        int num_colors = hybrid_evolutionary_coloring(graph, colors, IMPROVEMENT_TIME_LIMIT, threads, CHECK_SEED, NULL);
+        failure = check_improved(graph, colors, num_colors, start_colors);
+    }
+    free(start);
+    free(colors);
+    return failure;
+}
+
+// --- Coloração Exata ---
+// Em grafos de até 12 vértices a força bruta dá o número cromático, e o relatório do branch and
+// bound tem de bater com ele: os cortes (cores possíveis, clique pré-colorida) não podem perder a
+// coloração ótima, e "ótimo" só pode ser declarado quando é verdade.
+
+#define EXACT_TIME_LIMIT 10.0 // Bem acima do necessário: só o limite de nós interrompe a busca
+
+// Tenta colorir v .. n - 1 com as cores 1 .. k; v não passa da maior cor já usada + 1, para não
+// repetir as permutações das cores.
+static bool brute_force_colorable(Graph *graph, int *colors, int v, int used, int k) {
+    if (v == graph->num_vertices) {
+        return true;
+    }
+    for (int c = 1; c <= k && c <= used + 1; c++) {
+        bool available = true;
+        for (int u = 0; u < v && available; u++) {
+            available = colors[u] != c || !graph_has_edge(graph, u, v);
+        }
+        colors[v] = c;
+        if (available && brute_force_colorable(graph, colors, v + 1, c > used ? c : used, k)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int brute_force_chromatic_number(Graph *graph) {
+    int *colors = property_colors(graph);
+    int k = 0;
+    while (!brute_force_colorable(graph, colors, 0, 0, k)) {
+        k++;
+    }
+    free(colors);
+    return k;
+}
+
+// Sem limite, a busca termina e acha o número cromático; com um nó só, para cedo, e os limites
+// informados ainda têm de cercá-lo.
+static const char *check_exact_coloring(Graph *graph) {
+    const long long node_limits[] = { LLONG_MAX, 1 };
+    int chromatic = brute_force_chromatic_number(graph);
+    int *colors = property_colors(graph);
+    const char *failure = NULL;
+    for (int i = 0; i < 2 && failure == NULL; i++) {
+        ExactColoringReport report;
+        int num_colors = exact_coloring(graph, colors, EXACT_TIME_LIMIT, node_limits[i], &report);
+        if (!coloring_is_valid(graph, colors)) {
+            failure = "coloração inválida";
+        } else if (num_colors != report.upper_bound || num_colors != property_max_color(graph, colors)) {
+            failure = "número de cores retornado difere da coloração";
+        } else if (report.lower_bound > chromatic || report.upper_bound < chromatic ||
+                   (report.optimal && report.lower_bound != report.upper_bound) ||
+                   (!report.optimal && report.lower_bound >= report.upper_bound) ||
+                   (i == 0 && !report.optimal)) {
+            snprintf(failure_text, sizeof(failure_text), "%s: %d .. %d cores%s, número cromático %d",
+                     i == 0 ? "sem limite de nós" : "limite de 1 nó", report.lower_bound, report.upper_bound,
+                     report.optimal ? " (ótimo)" : "", chromatic);
+            failure = failure_text;
+        }
+    }
+    free(colors);
+    return failure;
+}
+
+// --- Clique Máxima ---
+// Nos mesmos grafos pequenos: a clique devolvida tem de ser uma clique de verdade e, quando a
+// busca diz que ela é máxima, ter o tamanho da maior achada por força bruta.
+
+// Maior clique que estende `size` vértices já escolhidos com os candidatos (bits, n <= 32). Cada
+// clique é visitada uma vez, pelos vértices em ordem crescente.
+static int brute_force_clique(const uint32_t *adj, uint32_t candidates, int size) {
+    int best = size;
+    while (candidates != 0) {
+        int v = __builtin_ctz(candidates);
+        candidates &= candidates - 1;
+        int found = brute_force_clique(adj, candidates & adj[v], size + 1);
+        if (found > best) best = found;
+    }
+    return best;
+}
+
+// Modo guloso, exato com prazo folgado (tem de provar) e exato com prazo zero (para na clique
+// gulosa, ou perto dela, sem provar nada).
+static const char *check_maximum_clique(Graph *graph) {
+    const CliqueMode modes[] = { CLIQUE_GREEDY, CLIQUE_EXACT, CLIQUE_EXACT };
+    const double time_limits[] = { 0.0, EXACT_TIME_LIMIT, 0.0 };
+    const char *mode_names[] = { "gulosa", "exata", "exata sem prazo" };
+    int n = graph->num_vertices;
+    uint32_t adj[32] = { 0 };
+    for (int u = 0; u < n; u++) {
+        for (int v = 0; v < n; v++) {
+            if (graph_has_edge(graph, u, v)) adj[u] |= 1u << v;
+        }
+    }
+    int maximum = brute_force_clique(adj, n == 32 ? ~0u : (1u << n) - 1, 0);
+
+    int *clique = property_colors(graph);
+    const char *failure = NULL;
+    for (int m = 0; m < 3 && failure == NULL; m++) {
+        bool proven;
+        int size = maximum_clique(graph, modes[m], time_limits[m], clique, &proven);
+        uint32_t members = 0;
+        bool is_clique = size >= (n > 0 ? 1 : 0);
+        for (int i = 0; i < size && is_clique; i++) {
+            int v = clique[i];
+            is_clique = v >= 0 && v < n && (members & (1u << v)) == 0 && (adj[v] & members) == members;
+            members |= 1u << v;
+        }
+        if (!is_clique) {
+            snprintf(failure_text, sizeof(failure_text), "%s: os %d vértices devolvidos não formam uma clique",
+                     mode_names[m], size);
+            failure = failure_text;
+        } else if (size > maximum || (proven && size != maximum) || (m == 1 && !proven)) {
+            snprintf(failure_text, sizeof(failure_text), "%s: clique de %d%s, máxima %d", mode_names[m], size,
+                     proven ? " (provada)" : "", maximum);
+            failure = failure_text;
+        }
+    }
+    free(clique);
+    return failure;
+}
+
+static const CheckedProperty checked_properties[] = {
+    { "IDO baldes", check_ido_bucket },
+    { "IG", check_iterated_greedy },
+    { "TabuCol", check_tabucol },
+    { "HEA", check_hybrid_evolutionary },
+};
+
+// Os algoritmos paralelos usam uma thread para cada 256 vértices (parallel_thread_count): só
+// grafos maiores exercitam várias threads de verdade.
+static const CheckedProperty parallel_properties[] = {
+    { "JP", check_jones_plassmann },
+    { "GM", check_speculative_greedy },
+};
+
+typedef struct {
+    int n;
+    double p;
+    uint64_t seed;
+} CheckedGraph;
+
+// Do esparso (vértices isolados, muitos empates) ao quase completo; n passa de 64 em alguns
+// para as linhas da matriz de bits terem mais de uma palavra.
+static const CheckedGraph checked_graphs[] = {
+    { 1, 0.0, 1 },
+    { 12, 0.0, 2 },
+    { 40, 0.05, 3 },
+    { 60, 0.3, 4 },
+    { 70, 0.5, 5 },
+    { 90, 0.9, 6 },
+    { 130, 0.1, 7 },
+    { 150, 0.5, 8 },
+    { 200, 0.02, 9 },
+};
+
+// Grafos dos algoritmos paralelos
+static const CheckedGraph parallel_graphs[] = {
+    { 1500, 0.01, 21 },
+    { 1100, 0.3, 22 },
+};
+
+// Grafos pequenos das buscas exatas: EXACT_SEEDS sementes em cada densidade, com n = 12 (a força
+// bruta da clique aceita até 32). Com essas, em ~10% dos grafos a clique é menor que o número
+// cromático e a busca precisa ramificar, e em alguns o DSATUR e o RLF usam uma cor a mais que o
+// necessário.
+static const CheckedProperty exact_properties[] = {
+    { "Exata", check_exact_coloring },
+    { "Clique", check_maximum_clique },
+};
+
+#define EXACT_VERTICES 12
+#define EXACT_SEEDS 40
+static const double exact_densities[] = { 0.2, 0.35, 0.5, 0.65, 0.8 };
+
+static int failures = 0;
+static int checks = 0;
+
+// Roda as verificações de propriedade no grafo, em cada representação
+static void check_properties(Graph *graph, const CheckedGraph *spec, const CheckedProperty *properties, int count) {
+    const GraphLayout layouts[] = { GRAPH_LAYOUT_CSR, GRAPH_LAYOUT_BITSET, GRAPH_LAYOUT_COMPRESSED };
+    for (int q = 0; q < count; q++) {
+        for (int l = 0; l < 3; l++) {
+            if (!graph_set_layout(graph, layouts[l])) {
+                exit(EXIT_FAILURE);
+            }
+            const char *failure = properties[q].check(graph);
+            checks++;
+            if (failure != NULL) {
+                failures++;
+                fprintf(stderr, "FALHA: %s em G(%d, %.2f) semente %llu, %s: %s\n", properties[q].name,
+                        spec->n, spec->p, (unsigned long long)spec->seed, graph_layout_name(layouts[l]), failure);
+            }
+        }
+    }
+}
+
+int main(void) {
+    const GraphLayout layouts[] = { GRAPH_LAYOUT_CSR, GRAPH_LAYOUT_BITSET, GRAPH_LAYOUT_COMPRESSED };
+    int num_graphs = sizeof(checked_graphs) / sizeof(checked_graphs[0]);
+    int num_algorithms = sizeof(checked_algorithms) / sizeof(checked_algorithms[0]);
+    int num_properties = sizeof(checked_properties) / sizeof(checked_properties[0]);
+
+    for (int g = 0; g < num_graphs; g++) {
+        const CheckedGraph *spec = &checked_graphs[g];
+        Graph *graph = check_random_graph(spec->n, spec->p, spec->seed);
+        int n = graph->num_vertices;
+        int *expected = (int *)malloc(n * sizeof(int));
+        int *colors = (int *)malloc(n * sizeof(int));
+        if (expected == NULL || colors == NULL) {
+            perror("Erro ao alocar memória para as colorações");
+            exit(EXIT_FAILURE);
+        }
+
+        for (int a = 0; a < num_algorithms; a++) {
+            const CheckedAlgorithm *alg = &checked_algorithms[a];
+            if (!graph_set_layout(graph, GRAPH_LAYOUT_CSR)) {
+                exit(EXIT_FAILURE);
+            }
+            int expected_colors = alg->reference(graph, expected);
+
+            for (int l = 0; l < 3; l++) {
+                if (!graph_set_layout(graph, layouts[l])) {
+                    exit(EXIT_FAILURE);
+                }
+                int num_colors = alg->kernel(graph, colors);
+                int first_diff = -1;
+                for (int v = 0; v < n && first_diff < 0; v++) {
+                    if (colors[v] != expected[v]) first_diff = v;
+                }
+                checks++;
+                if (num_colors != expected_colors || first_diff >= 0) {
+                    failures++;
+                    fprintf(stderr, "FALHA: %s em G(%d, %.2f) semente %llu, %s: %d cores (esperado %d)",
+                            alg->name, spec->n, spec->p, (unsigned long long)spec->seed,
+                            graph_layout_name(layouts[l]), num_colors, expected_colors);
+                    if (first_diff >= 0) {
+                        fprintf(stderr, ", vértice %d com cor %d (esperado %d)", first_diff,
+                                colors[first_diff], expected[first_diff]);
+                    }
+                    fprintf(stderr, "\n");
+                }
+            }
+        }
+
+        check_properties(graph, spec, checked_properties, num_properties);
+
+        free(expected);
+        free(colors);
+        free_graph(graph);
+    }
+
+    int num_parallel_graphs = sizeof(parallel_graphs) / sizeof(parallel_graphs[0]);
+    int num_parallel = sizeof(parallel_properties) / sizeof(parallel_properties[0]);
+    for (int g = 0; g < num_parallel_graphs; g++) {
+        const CheckedGraph *spec = &parallel_graphs[g];
+        Graph *graph = check_random_graph(spec->n, spec->p, spec->seed);
+        check_properties(graph, spec, parallel_properties, num_parallel);
+        free_graph(graph);
+    }
+
+    int num_densities = sizeof(exact_densities) / sizeof(exact_densities[0]);
+    int num_exact = sizeof(exact_properties) / sizeof(exact_properties[0]);
+    for (int d = 0; d < num_densities; d++) {
+        for (int seed = 1; seed <= EXACT_SEEDS; seed++) {
+            CheckedGraph spec = { EXACT_VERTICES, exact_densities[d], seed };
+            Graph *graph = check_random_graph(spec.n, spec.p, spec.seed);
+            check_properties(graph, &spec, exact_properties, num_exact);
+            free_graph(graph);
+        }
+    }
+
+    printf("%d verificações, %d falhas\n", checks, failures);
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
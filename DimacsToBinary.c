@@ -0,0 +1,53 @@
+#include <stdio.h>   // Para entrada/saída (printf, fprintf, perror)
+#include <stdlib.h>  // Para alocação de memória (malloc, free)
+#include <time.h>    // Para medir o tempo de parede (clock_gettime, CLOCK_MONOTONIC)
+
+#include "graph.h"    // Grafo, leitura DIMACS e cache binário
+
+// Tempo de parede em segundos. clock() somaria a CPU de todas as threads do carregador e
+// esconderia o ganho da leitura paralela.
+static double wall_time(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// --- Função Principal (main) do Conversor ---
+// Converte arquivos de grafo para o cache binário "<arquivo>.bin", que read_dimacs_graph passa a
+// usar automaticamente enquanto for mais novo que o texto. O formato do texto vem da extensão:
+// ".mtx" é Matrix Market, ".txt"/".edges"/".el"/".tsv" lista de arestas, o resto DIMACS.
+// Uso: ./DimacsToBinary arquivo1 [arquivo2 ...]
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Uso: %s arquivo_dimacs [arquivo_dimacs ...]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    int failures = 0;
+    for (int i = 1; i < argc; i++) {
+        const char *filename = argv[i];
+
+        double start_time = wall_time();
+        Graph *my_graph = read_graph_text(filename, 0); // Sempre relê o texto, ignorando cache antigo
+        if (my_graph == NULL) {
+            fprintf(stderr, "Erro: Não foi possível carregar o grafo %s. Pulando para o próximo.\n", filename);
+            failures++;
+            continue;
+        }
+
+        char *cache_path = graph_cache_path(filename);
+        if (cache_path == NULL || !write_graph_cache(my_graph, cache_path)) {
+            fprintf(stderr, "Erro: Não foi possível gravar o cache de %s.\n", filename);
+            failures++;
+        } else {
+            double elapsed = wall_time() - start_time;
+            printf("%-20s -> %-24s %-10d vértices %-10lld arestas %.4f s\n", filename, cache_path,
+                   my_graph->num_vertices, (long long)my_graph->num_arestas, elapsed);
+        }
+
+        free(cache_path);
+        free_graph(my_graph);
+    }
+
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,68 @@
+#include <stdio.h>   // Para entrada/saída (printf, fprintf, perror)
+#include <stdlib.h>  // Para alocação de memória (malloc, free)
+
+#include "graph.h"    // Grafo, leitura DIMACS e cache binário
+#include "coloring.h" // Algoritmos de coloração
+
+#define EXACT_TIME_LIMIT 60.0          // Prazo por instância, em segundos
+#define EXACT_NODE_LIMIT 1000000000LL  // Nós da busca por instância
+
+// --- Função Principal (main) para Testar ---
+// Uso: ./ExactColoring [arquivo ...] (sem argumentos, roda as instâncias pequenas e médias).
+// Mostra o número cromático provado ou, se um limite acabar antes, os limites e a diferença.
+int main(int argc, char **argv) {
+    // Instâncias em que a busca exata é viável
+    const char *default_files[] = {
+        "dsjc250.5", "r250.5", "dsjc500.1", "dsjr500.1c", "le450_25c", "le450.25d", "flat300_28_0", "latin_square"
+    };
+    const char **instance_files = default_files;
+    int num_instances = sizeof(default_files) / sizeof(default_files[0]);
+    if (argc > 1) {
+        instance_files = (const char **)(argv + 1);
+        num_instances = argc - 1;
+    }
+
+    printf("--- Coloração Exata (DSATUR com branch and bound, %.0f s ou %lld nós por instância) ---\n\n",
+           EXACT_TIME_LIMIT, EXACT_NODE_LIMIT);
+    printf("%-20s %-10s %-10s %-10s %-10s %-15s %-15s\n", "Instancia", "Vertices", "Inferior", "Superior", "Resultado", "Nos", "Tempo (s)");
+    printf("-----------------------------------------------------------------------------------------------\n");
+
+    for (int i = 0; i < num_instances; i++) {
+        const char *filename = instance_files[i];
+        Graph *my_graph = read_graph(filename);
+
+        if (my_graph) {
+            int *vertex_colors = (int *)malloc(my_graph->num_vertices * sizeof(int));
+
+            if (vertex_colors == NULL) {
+                perror("Erro ao alocar memória para cores dos vértices");
+                free_graph(my_graph); // Libera o grafo (listas CSR e estrutura)
+                continue; // Pular para a próxima instância
+            }
+
+            ExactColoringReport report;
+            int num_colors = exact_coloring(my_graph, vertex_colors, EXACT_TIME_LIMIT, EXACT_NODE_LIMIT, &report);
+            // Conferida contra o grafo, como as colorações paralelas em ParallelColoring.c
+            if (!coloring_is_valid(my_graph, vertex_colors) || num_colors != report.upper_bound) {
+                fprintf(stderr, "Erro: coloração exata inválida em %s.\n", filename);
+            }
+
+            char result[32];
+            if (report.optimal) {
+                snprintf(result, sizeof(result), "otimo");
+            } else {
+                snprintf(result, sizeof(result), "gap %d", report.upper_bound - report.lower_bound);
+            }
+            printf("%-20s %-10d %-10d %-10d %-10s %-15lld %-15.4f\n",
+                   filename, my_graph->num_vertices, report.lower_bound, report.upper_bound, result,
+                   report.nodes, report.seconds);
+
+            free(vertex_colors);
+            free_graph(my_graph); // Libera o grafo (listas CSR e estrutura)
+        } else {
+            fprintf(stderr, "Erro: Não foi possível carregar o grafo %s. Pulando para o próximo.\n", filename);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,208 @@
+#include <stdio.h>     // Para entrada/saída (printf, fprintf, fopen, fwrite)
+#include <stdlib.h>    // Para alocação de memória e mkdtemp (malloc, free, exit)
+#include <string.h>    // Para strlen, snprintf
+#include <fcntl.h>     // Para AT_FDCWD
+#include <unistd.h>    // Para unlink, rmdir
+#include <sys/stat.h>  // Para stat, utimensat
+
+#include "graph.h" // Leitores de texto e cache binário
+
+// --- Verificação dos Leitores e do Cache Binário ---
+// Arquivos pequenos, escritos num diretório temporário, com os casos que os leitores precisam
+// tratar nos três formatos (DIMACS, lista de arestas, Matrix Market): finais "\r\n",
+// comentários, linhas vazias, vértices 0- e 1-baseados, laços e arestas repetidas ou invertidas.
+// Cada grafo lido é conferido (n, m, o relatório de descartes e a adjacência completa) nas
+// representações CSR e BITSET, e de novo depois de gravado no cache e mapeado de volta.
+// Uso: make check (ou ./GraphIoCheck). Sai com erro se algo diferir.
+
+typedef Graph *(*ReaderFn)(const char *filename, int num_threads);
+
+typedef struct {
+    const char *name;   // Nome do arquivo (a extensão escolhe o formato em read_graph_text)
+    const char *text;
+    ReaderFn reader;
+    int n;              // Vértices esperados
+    int m;              // Arestas distintas esperadas
+    int self_loops;     // Laços descartados
+    int duplicates;     // Repetições (inclusive invertidas) descartadas
+    int edges[8][2];    // As m arestas, 0-baseadas
+} IoFixture;
+
+static const IoFixture fixtures[] = {
+    // DIMACS com "\r\n", comentários antes e no meio das arestas e uma linha vazia
+    { "crlf.col",
+      "c fixture com finais CRLF\r\np edge 5 4\r\ne 1 2\r\nc comentario no meio\r\ne 2 3\r\n\r\ne 4 5\r\ne 1 5\r\n",
+      read_dimacs_text, 5, 4, 0, 0, { { 0, 1 }, { 1, 2 }, { 3, 4 }, { 0, 4 } } },
+    // "p col", vértice isolado (o 6) e espaços extras
+    { "col.col",
+      "p col 6 3\ne  1 3\ne 2   4\ne 3 5\n",
+      read_dimacs_text, 6, 3, 0, 0, { { 0, 2 }, { 1, 3 }, { 2, 4 } } },
+    // Laços, repetições e arestas invertidas: só as distintas entram em m, e a linha 'p'
+    // (que conta as linhas 'e') não vale como número de arestas
+    { "dups.col",
+      "p edge 4 9\ne 1 2\ne 2 1\ne 3 3\ne 1 2\ne 2 3\ne 4 4\ne 3 2\ne 1 4\ne 4 1\n",
+      read_dimacs_text, 4, 3, 2, 4, { { 0, 1 }, { 1, 2 }, { 0, 3 } } },
+    // SNAP: 0-baseada, comentários '#', tabulações, coluna extra, laço, aresta nos dois sentidos
+    { "snap.txt",
+      "# Directed graph\n# FromNodeId\tToNodeId\n0\t1\n1\t0\n2\t3\t7\n3 3\n\n4 0\r\n",
+      read_edge_list_text, 5, 3, 1, 1, { { 0, 1 }, { 2, 3 }, { 0, 4 } } },
+    // Comentários '%' (KONECT); sem cabeçalho, n é o maior vértice + 1 e o 0 fica isolado
+    { "konect.el",
+      "% sym unweighted\n% 2 3 3\n1 2\n2 3 1 1234\n",
+      read_graph_text, 4, 2, 0, 0, { { 1, 2 }, { 2, 3 } } },
+    // Matrix Market simétrico 1-baseado: a diagonal é laço, (3, 2) repetida
+    { "sym.mtx",
+      "%%MatrixMarket matrix coordinate pattern symmetric\n% comentario\n4 4 5\n1 1\n2 1\n3 2\n4 3\n3 2\n",
+      read_matrix_market_text, 4, 3, 1, 1, { { 0, 1 }, { 1, 2 }, { 2, 3 } } },
+    // Matrix Market geral com valores e "\r\n": (1, 2) e (2, 1) são a mesma aresta
+    { "general.mtx",
+      "%%MatrixMarket matrix coordinate real general\r\n%\r\n3 3 3\r\n1 2 0.5\r\n2 1 -1.0\r\n3 1 2e3\r\n",
+      read_graph_text, 3, 2, 0, 1, { { 0, 1 }, { 0, 2 } } },
+};
+
+static int failures = 0;
+static int checks = 0;
+
+static void check(bool condition, const char *fixture, const char *stage, const char *what) {
+    checks++;
+    if (!condition) {
+        failures++;
+        fprintf(stderr, "FALHA: %s (%s): %s\n", fixture, stage, what);
+    }
+}
+
+// Confere n, m, os descartes e a adjacência inteira: graph_has_edge em todos os pares e os vizinhos de cada
+// vértice pela iteração (que é o que os algoritmos usam), em ordem crescente e sem repetição.
+static void check_graph(const IoFixture *fx, Graph *graph, const char *stage) {
+    if (graph == NULL) {
+        check(false, fx->name, stage, "leitura falhou");
+        return;
+    }
+    check(graph->num_vertices == fx->n, fx->name, stage, "número de vértices");
+    check(graph->num_arestas == fx->m, fx->name, stage, "número de arestas");
+    check(graph->num_self_loops == fx->self_loops, fx->name, stage, "laços descartados");
+    check(graph->num_duplicates == fx->duplicates, fx->name, stage, "repetições descartadas");
+    if (graph->num_vertices != fx->n) return;
+
+    bool adjacency_ok = true;
+    for (int u = 0; u < fx->n; u++) {
+        for (int v = 0; v < fx->n; v++) {
+            bool expected = false;
+            for (int e = 0; e < fx->m; e++) {
+                expected = expected || (fx->edges[e][0] == u && fx->edges[e][1] == v) ||
+                                       (fx->edges[e][0] == v && fx->edges[e][1] == u);
+            }
+            adjacency_ok = adjacency_ok && graph_has_edge(graph, u, v) == expected;
+        }
+    }
+    check(adjacency_ok, fx->name, stage, "graph_has_edge");
+
+    bool neighbors_ok = true;
+    int64_t entries = 0;
+    for (int u = 0; u < fx->n; u++) {
+        int previous = -1;
+        int v;
+        for (NeighborIter it = graph_neighbors(graph, u); neighbor_next(&it, &v);) {
+            neighbors_ok = neighbors_ok && v > previous && v < fx->n && graph_has_edge(graph, u, v);
+            previous = v;
+            entries++;
+        }
+    }
+    check(neighbors_ok && entries == 2 * (int64_t)fx->m, fx->name, stage, "iteração dos vizinhos");
+}
+
+static void write_text(const char *path, const char *text) {
+    FILE *file = fopen(path, "wb");
+    if (file == NULL || fwrite(text, 1, strlen(text), file) != strlen(text) || fclose(file) != 0) {
+        perror("Erro ao gravar o arquivo de teste");
+        exit(EXIT_FAILURE);
+    }
+}
+
+// Muda a data de modificação do arquivo para `seconds` segundos depois da de `reference`.
+static void set_mtime(const char *path, const char *reference, long seconds) {
+    struct stat st;
+    if (stat(reference, &st) != 0) {
+        perror("Erro ao ler a data do arquivo de teste");
+        exit(EXIT_FAILURE);
+    }
+    struct timespec times[2] = { st.st_mtim, st.st_mtim };
+    times[0].tv_sec += seconds;
+    times[1].tv_sec += seconds;
+    if (utimensat(AT_FDCWD, path, times, 0) != 0) {
+        perror("Erro ao mudar a data do arquivo de teste");
+        exit(EXIT_FAILURE);
+    }
+}
+
+// Lê o arquivo e confere o grafo em cada representação do cache, antes e depois da ida e volta.
+static void check_fixture(const IoFixture *fx, const char *dir) {
+    const GraphLayout layouts[] = { GRAPH_LAYOUT_CSR, GRAPH_LAYOUT_BITSET };
+    char path[512], cache[520];
+    snprintf(path, sizeof(path), "%s/%s", dir, fx->name);
+    snprintf(cache, sizeof(cache), "%s.bin", path);
+    write_text(path, fx->text);
+
+    for (int l = 0; l < 2; l++) {
+        char stage[64];
+        Graph *graph = fx->reader(path, 0);
+        snprintf(stage, sizeof(stage), "texto, %s", graph_layout_name(layouts[l]));
+        if (graph != NULL && !graph_set_layout(graph, layouts[l])) {
+            exit(EXIT_FAILURE);
+        }
+        check_graph(fx, graph, stage);
+        if (graph == NULL) return;
+
+        // Ida e volta pelo cache: a representação gravada volta mapeada, sem reconstrução
+        check(write_graph_cache(graph, cache), fx->name, stage, "gravação do cache");
+        Graph *cached = load_graph_cache(cache);
+        snprintf(stage, sizeof(stage), "cache, %s", graph_layout_name(layouts[l]));
+        check_graph(fx, cached, stage);
+        if (cached != NULL) {
+            check(cached->layout == layouts[l] && cached->mapping != NULL, fx->name, stage, "representação mapeada");
+            free_graph(cached);
+        }
+        free_graph(graph);
+    }
+
+    // O cache só substitui o texto se for estritamente mais novo
+    set_mtime(path, cache, -10);
+    Graph *graph = read_graph(path);
+    check(graph != NULL && graph->mapping != NULL, fx->name, "read_graph", "cache mais novo não foi usado");
+    check_graph(fx, graph, "read_graph, cache mais novo");
+    free_graph(graph);
+    set_mtime(path, cache, 0);
+    graph = read_graph(path);
+    check(graph != NULL && graph->mapping == NULL, fx->name, "read_graph", "cache com a mesma data foi usado");
+    check_graph(fx, graph, "read_graph, mesma data");
+    free_graph(graph);
+
+    unlink(cache);
+    unlink(path);
+}
+
+int main(void) {
+    char dir[] = "/tmp/graphiocheck.XXXXXX";
+    if (mkdtemp(dir) == NULL) {
+        perror("Erro ao criar o diretório de teste");
+        return EXIT_FAILURE;
+    }
+
+    int num_fixtures = sizeof(fixtures) / sizeof(fixtures[0]);
+    for (int i = 0; i < num_fixtures; i++) {
+        check_fixture(&fixtures[i], dir);
+    }
+
+    // Matriz que não é quadrada não é adjacência de grafo: o leitor recusa
+    char path[512];
+    snprintf(path, sizeof(path), "%s/rect.mtx", dir);
+    write_text(path, "%%MatrixMarket matrix coordinate pattern general\n3 4 1\n1 2\n");
+    Graph *rect = read_matrix_market_text(path, 0);
+    check(rect == NULL, "rect.mtx", "texto", "matriz 3 x 4 aceita");
+    free_graph(rect);
+    unlink(path);
+    rmdir(dir);
+
+    printf("%d verificações, %d falhas\n", checks, failures);
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
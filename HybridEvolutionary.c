@@ -0,0 +1,101 @@
+#include <stdio.h>   // Para entrada/saída (printf, fprintf, perror)
+#include <stdlib.h>  // Para alocação de memória (malloc, free)
+#include <time.h>    // Para medir o tempo de parede (clock_gettime, CLOCK_MONOTONIC)
+
+#include "graph.h"    // Grafo, leitura DIMACS e cache binário
+#include "coloring.h" // Algoritmos de coloração
+
+#define HEA_TIME_LIMIT 5.0 // Prazo do algoritmo evolutivo por instância, em segundos
+#define SEED 12345         // Semente do algoritmo evolutivo
+
+// Tempo de parede em segundos
+static double wall_time(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// --- Função Principal (main) para Testar ---
+// Uso: ./HybridEvolutionary [arquivo ...] (sem argumentos, roda as instâncias DIMACS do benchmark).
+// Parte da melhor coloração construtiva (DSATUR ou RLF) e mostra, para cada k alcançado, o tempo
+// até a primeira k-coloração.
+int main(int argc, char **argv) {
+    // Lista das instâncias de teste que você precisa rodar
+    const char *default_files[] = {
+        "dsjc250.5", "dsjc500.1", "dsjc500.5", "dsjc500.9", "dsjc1000.1", "dsjc1000.5", "dsjc1000.9",
+        "r250.5", "r1000.1c", "r1000.5", "dsjr500.1c","dsjr500.5", "le450_25c", "le450.25d",
+        "flat300_28_0", "flat1000_50_0", "flat1000_60_0", "flat1000_76_0", "latin_square", "C2000.5", "C4000.5"
+    };
+    const char **instance_files = default_files;
+    int num_instances = sizeof(default_files) / sizeof(default_files[0]);
+    if (argc > 1) {
+        instance_files = (const char **)(argv + 1);
+        num_instances = argc - 1;
+    }
+
+    printf("--- Algoritmo Evolutivo Híbrido (%.0f s por instância, uma thread por CPU, tempos de parede) ---\n\n", HEA_TIME_LIMIT);
+    printf("%-20s %-10s %-8s %-12s %-10s %-15s %s\n", "Instancia", "Vertices", "Inicial", "Construtivo", "Cores HEA", "Tempo HEA (s)", "Tempo ate k (s)");
+    printf("--------------------------------------------------------------------------------------------------------\n");
+
+    for (int i = 0; i < num_instances; i++) {
+        const char *filename = instance_files[i];
+        Graph *my_graph = read_graph(filename);
+
+        if (my_graph) {
+            int n = my_graph->num_vertices;
+            int *vertex_colors = (int *)malloc(n * sizeof(int));
+            int *vertex_colors_rlf = (int *)malloc(n * sizeof(int));
+
+            if (vertex_colors == NULL || vertex_colors_rlf == NULL) {
+                perror("Erro ao alocar memória para cores dos vértices");
+                free_graph(my_graph); // Libera o grafo (listas CSR e estrutura)
+                if (vertex_colors) free(vertex_colors);
+                if (vertex_colors_rlf) free(vertex_colors_rlf);
+                continue; // Pular para a próxima instância
+            }
+
+            // --- Melhor coloração construtiva ---
+            int num_colors_start = dsatur_coloring(my_graph, vertex_colors);
+            const char *start_name = "DSATUR";
+            int num_colors_rlf = recursive_largest_first_coloring(my_graph, vertex_colors_rlf);
+            if (num_colors_rlf < num_colors_start) {
+                int *swap = vertex_colors;
+                vertex_colors = vertex_colors_rlf;
+                vertex_colors_rlf = swap;
+                num_colors_start = num_colors_rlf;
+                start_name = "RLF";
+            }
+
+            double *time_to_k = (double *)malloc((num_colors_start + 1) * sizeof(double));
+            if (time_to_k == NULL) {
+                perror("Erro ao alocar memória para os tempos do algoritmo evolutivo");
+                exit(EXIT_FAILURE);
+            }
+
+            // --- Executar o Algoritmo Evolutivo Híbrido ---
+            double start_time_hea = wall_time();
+            int num_colors_hea = hybrid_evolutionary_coloring(my_graph, vertex_colors, HEA_TIME_LIMIT, 0, SEED, time_to_k);
+            double time_hea = wall_time() - start_time_hea;
+            // Conferida contra o grafo, como as colorações paralelas em ParallelColoring.c
+            if (!coloring_is_valid(my_graph, vertex_colors) || num_colors_hea > num_colors_start) {
+                fprintf(stderr, "Erro: coloração HEA inválida ou pior que a inicial em %s.\n", filename);
+            }
+
+            printf("%-20s %-10d %-8d %-12s %-10d %-15.4f", filename, n, num_colors_start, start_name,
+                   num_colors_hea, time_hea);
+            for (int k = num_colors_start - 1; k >= num_colors_hea; k--) {
+                printf(" k=%d:%.3f", k, time_to_k[k]);
+            }
+            printf("\n");
+
+            free(time_to_k);
+            free(vertex_colors);
+            free(vertex_colors_rlf);
+            free_graph(my_graph); // Libera o grafo (listas CSR e estrutura)
+        } else {
+            fprintf(stderr, "Erro: Não foi possível carregar o grafo %s. Pulando para o próximo.\n", filename);
+        }
+    }
+
+    return 0;
+}
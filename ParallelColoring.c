@@ -0,0 +1,97 @@
+#include <stdio.h>   // Para entrada/saída (printf, fprintf, perror)
+#include <stdlib.h>  // Para alocação de memória (malloc, free)
+#include <time.h>    // Para medir o tempo de parede (clock_gettime, CLOCK_MONOTONIC)
+
+#include "graph.h"    // Grafo, leitura DIMACS e cache binário
+#include "coloring.h" // Algoritmos de coloração
+
+#define SEED 12345 // Semente das prioridades: mesma semente, mesma coloração
+
+// Tempo de parede em segundos (clock() somaria o tempo de CPU de todas as threads)
+static double wall_time(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// --- Função Principal (main) para Testar ---
+// Uso: ./ParallelColoring [arquivo ...] (sem argumentos, roda as instâncias DIMACS do benchmark).
+// Os arquivos podem ser DIMACS, listas de arestas ou Matrix Market (ver read_graph).
+int main(int argc, char **argv) {
+    // Lista das instâncias de teste que você precisa rodar
+    const char *default_files[] = {
+        "dsjc250.5", "dsjc500.1", "dsjc500.5", "dsjc500.9", "dsjc1000.1", "dsjc1000.5", "dsjc1000.9",
+        "r250.5", "r1000.1c", "r1000.5", "dsjr500.1c","dsjr500.5", "le450_25c", "le450.25d",
+        "flat300_28_0", "flat1000_50_0", "flat1000_60_0", "flat1000_76_0", "latin_square", "C2000.5", "C4000.5"
+    };
+    const char **instance_files = default_files;
+    int num_instances = sizeof(default_files) / sizeof(default_files[0]);
+    int exit_status = EXIT_SUCCESS;
+    if (argc > 1) {
+        instance_files = (const char **)(argv + 1);
+        num_instances = argc - 1;
+    }
+
+    printf("--- Coloração Paralela (tempos de parede, uma thread por CPU) ---\n\n");
+    printf("%-20s %-10s %-8s %-10s %-15s %-10s %-15s %-10s %-15s\n", "Instancia", "Vertices", "Layout", "Cores FF", "Tempo FF (s)", "Cores JP", "Tempo JP (s)", "Cores GM", "Tempo GM (s)");
+    printf("------------------------------------------------------------------------------------------------------------------------\n");
+
+    for (int i = 0; i < num_instances; i++) {
+        const char *filename = instance_files[i];
+        Graph *my_graph = read_graph(filename);
+
+        if (my_graph) {
+            int *vertex_colors_ff = (int *)malloc(my_graph->num_vertices * sizeof(int));
+            int *vertex_colors_jp = (int *)malloc(my_graph->num_vertices * sizeof(int));
+            int *vertex_colors_gm = (int *)malloc(my_graph->num_vertices * sizeof(int));
+
+            if (vertex_colors_ff == NULL || vertex_colors_jp == NULL || vertex_colors_gm == NULL) {
+                perror("Erro ao alocar memória para cores dos vértices");
+                free_graph(my_graph); // Libera o grafo (listas CSR e estrutura)
+                if (vertex_colors_ff) free(vertex_colors_ff);
+                if (vertex_colors_jp) free(vertex_colors_jp);
+                if (vertex_colors_gm) free(vertex_colors_gm);
+                continue; // Pular para a próxima instância
+            }
+
+            // --- Executar First Fit (sequencial, referência) ---
+            double start_time_ff = wall_time();
+            int num_colors_ff = first_fit_coloring(my_graph, vertex_colors_ff);
+            double time_ff = wall_time() - start_time_ff;
+
+            // --- Executar Jones-Plassmann ---
+            double start_time_jp = wall_time();
+            int num_colors_jp = jones_plassmann_coloring(my_graph, vertex_colors_jp, 0, SEED);
+            double time_jp = wall_time() - start_time_jp;
+
+            // --- Executar Gebremedhin-Manne (mesma ordem natural do First Fit) ---
+            double start_time_gm = wall_time();
+            int num_colors_gm = speculative_greedy_coloring(my_graph, NULL, vertex_colors_gm, 0);
+            double time_gm = wall_time() - start_time_gm;
+
+            // As colorações paralelas são conferidas contra o grafo: o GM depende de como as threads
+            // se intercalam, e um erro aqui passaria despercebido no número de cores
+            const char *invalid = !coloring_is_valid(my_graph, vertex_colors_ff) ? "FF"
+                                : !coloring_is_valid(my_graph, vertex_colors_jp) ? "JP"
+                                : !coloring_is_valid(my_graph, vertex_colors_gm) ? "GM"
+                                : NULL;
+            if (invalid) {
+                fprintf(stderr, "Erro: coloração %s inválida em %s.\n", invalid, filename);
+                exit_status = EXIT_FAILURE;
+            }
+
+            printf("%-20s %-10d %-8s %-10d %-15.4f %-10d %-15.4f %-10d %-15.4f\n",
+                   filename, my_graph->num_vertices, graph_layout_name(my_graph->layout), num_colors_ff, time_ff,
+                   num_colors_jp, time_jp, num_colors_gm, time_gm);
+
+            free(vertex_colors_ff); // Libera o array de cores FF
+            free(vertex_colors_jp); // Libera o array de cores JP
+            free(vertex_colors_gm); // Libera o array de cores GM
+            free_graph(my_graph); // Libera o grafo (listas CSR e estrutura)
+        } else {
+            fprintf(stderr, "Erro: Não foi possível carregar o grafo %s. Pulando para o próximo.\n", filename);
+        }
+    }
+
+    return exit_status;
+}
@@ -0,0 +1,191 @@
+#include <stdio.h>   // Para perror
+#include <stdlib.h>  // Para alocação de memória (malloc, calloc, free, exit)
+
+#include "coloring.h"
+
+// --- Análise do Grafo ---
+// Dados que vários algoritmos pedem do mesmo grafo (graus, ordens, componentes, uma clique),
+// calculados na primeira vez que alguém os pede e guardados em graph->analysis até free_graph.
+// Mudar a representação com graph_set_layout não altera o grafo, então a análise continua válida.
+// Não é thread-safe: algoritmos paralelos devem pedir o que usam antes de criar as threads.
+
+struct GraphAnalysis {
+    int *degree;              // Grau de cada vértice (NULL: ainda não calculado)
+    int max_degree;
+    int *degree_order;        // degree_ordering
+    int *smallest_last_order; // smallest_last_ordering
+    int degeneracy;
+    int *component;           // Componente conexa de cada vértice, 0 .. num_components - 1
+    int num_components;
+    int *clique;              // Clique encontrada pela busca gulosa
+    int clique_size;          // -1: ainda não calculada
+};
+
+void graph_analysis_free(struct GraphAnalysis *analysis) {
+    if (analysis == NULL) return;
+    free(analysis->degree);
+    free(analysis->degree_order);
+    free(analysis->smallest_last_order);
+    free(analysis->component);
+    free(analysis->clique);
+    free(analysis);
+}
+
+// Vetor de n inteiros para a análise; falta de memória aqui encerra o programa, como nos
+// algoritmos de coloração.
+static int *analysis_alloc(Graph *graph, const char *what) {
+    int *array = (int *)malloc((graph->num_vertices > 0 ? graph->num_vertices : 1) * sizeof(int));
+    if (array == NULL) {
+        perror(what);
+        exit(EXIT_FAILURE);
+    }
+    return array;
+}
+
+static struct GraphAnalysis *graph_analysis(Graph *graph) {
+    if (graph->analysis == NULL) {
+        graph->analysis = (struct GraphAnalysis *)calloc(1, sizeof(struct GraphAnalysis));
+        if (graph->analysis == NULL) {
+            perror("Erro ao alocar memória para a análise do grafo");
+            exit(EXIT_FAILURE);
+        }
+        graph->analysis->clique_size = -1;
+    }
+    return graph->analysis;
+}
+
+const int *graph_degrees(Graph *graph) {
+    struct GraphAnalysis *analysis = graph_analysis(graph);
+    if (analysis->degree == NULL) {
+        int *degree = analysis_alloc(graph, "Erro ao alocar memória para os graus");
+        int max_degree = 0;
+        for (int v = 0; v < graph->num_vertices; v++) {
+            degree[v] = graph_degree(graph, v);
+            if (degree[v] > max_degree) {
+                max_degree = degree[v];
+            }
+        }
+        analysis->degree = degree;
+        analysis->max_degree = max_degree;
+    }
+    return analysis->degree;
+}
+
+int graph_max_degree(Graph *graph) {
+    graph_degrees(graph);
+    return graph->analysis->max_degree;
+}
+
+const int *graph_degree_order(Graph *graph) {
+    struct GraphAnalysis *analysis = graph_analysis(graph);
+    if (analysis->degree_order == NULL) {
+        int *order = analysis_alloc(graph, "Erro ao alocar memória para a ordem por grau");
+        degree_ordering(graph, order);
+        analysis->degree_order = order;
+    }
+    return analysis->degree_order;
+}
+
+const int *graph_smallest_last_order(Graph *graph) {
+    struct GraphAnalysis *analysis = graph_analysis(graph);
+    if (analysis->smallest_last_order == NULL) {
+        int *order = analysis_alloc(graph, "Erro ao alocar memória para a ordem smallest-last");
+        analysis->degeneracy = smallest_last_ordering(graph, order);
+        analysis->smallest_last_order = order;
+    }
+    return analysis->smallest_last_order;
+}
+
+int graph_degeneracy(Graph *graph) {
+    graph_smallest_last_order(graph);
+    return graph->analysis->degeneracy;
+}
+
+const int *graph_components(Graph *graph, int *num_components) {
+    struct GraphAnalysis *analysis = graph_analysis(graph);
+    if (analysis->component == NULL) {
+        int n = graph->num_vertices;
+        int *component = analysis_alloc(graph, "Erro ao alocar memória para as componentes");
+        int *queue = analysis_alloc(graph, "Erro ao alocar memória para a fila da BFS");
+        for (int v = 0; v < n; v++) {
+            component[v] = -1;
+        }
+
+        // Uma BFS por componente; a fila nunca recebe um vértice duas vezes
+        int count = 0;
+        for (int s = 0; s < n; s++) {
+            if (component[s] >= 0) continue;
+            int head = 0, tail = 0;
+            queue[tail++] = s;
+            component[s] = count;
+            while (head < tail) {
+                int v = queue[head++];
+                int u;
+                for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &u);) {
+                    if (component[u] < 0) {
+                        component[u] = count;
+                        queue[tail++] = u;
+                    }
+                }
+            }
+            count++;
+        }
+
+        free(queue);
+        analysis->component = component;
+        analysis->num_components = count;
+    }
+    if (num_components != NULL) {
+        *num_components = analysis->num_components;
+    }
+    return analysis->component;
+}
+
+int graph_clique_lower_bound(Graph *graph, const int **clique) {
+    struct GraphAnalysis *analysis = graph_analysis(graph);
+    if (analysis->clique_size < 0) {
+        int n = graph->num_vertices;
+        const int *order = graph_smallest_last_order(graph);
+        // rank[v]: posição de v na ordem smallest-last. Os vizinhos de v que vêm antes dele são
+        // no máximo degeneracy, e toda clique está inteira entre os vizinhos anteriores do seu
+        // último vértice. A busca gulosa parte de cada v e tenta acrescentar esses vizinhos.
+        int *rank = analysis_alloc(graph, "Erro ao alocar memória para a busca de clique");
+        int *current = analysis_alloc(graph, "Erro ao alocar memória para a busca de clique");
+        int *best = analysis_alloc(graph, "Erro ao alocar memória para a busca de clique");
+        for (int i = 0; i < n; i++) {
+            rank[order[i]] = i;
+        }
+
+        int best_size = 0;
+        for (int v = 0; v < n; v++) {
+            int size = 0;
+            current[size++] = v;
+            int u;
+            for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &u);) {
+                if (rank[u] > rank[v]) continue;
+                bool adjacent_to_all = true;
+                for (int j = 1; j < size && adjacent_to_all; j++) {
+                    adjacent_to_all = graph_has_edge(graph, u, current[j]);
+                }
+                if (adjacent_to_all) {
+                    current[size++] = u;
+                }
+            }
+            if (size > best_size) {
+                best_size = size;
+                int *swap = best;
+                best = current;
+                current = swap;
+            }
+        }
+
+        free(rank);
+        free(current);
+        analysis->clique = best;
+        analysis->clique_size = best_size;
+    }
+    if (clique != NULL) {
+        *clique = analysis->clique;
+    }
+    return analysis->clique_size;
+}
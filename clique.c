@@ -0,0 +1,217 @@
+#include <stdio.h>   // Para perror
+#include <stdlib.h>  // Para alocação de memória (malloc, calloc, free, exit)
+#include <time.h>    // Para o prazo em tempo de parede (clock_gettime, CLOCK_MONOTONIC)
+
+#include "coloring.h"
+
+// --- Clique Máxima (Branch and Bound com Coloração, estilo BBMC) ---
+// Os vértices são renumerados na ordem smallest-last e o grafo vira uma matriz de bits nessa
+// numeração. Cada nó da busca tem o conjunto P de candidatos (vizinhos de todos os vértices da
+// clique atual C) e o colore gulosamente, classe por classe, palavra a palavra: uma classe é
+// montada tirando o primeiro candidato e removendo os vizinhos dele (Q &= ~adj[v]). Um vértice
+// com cor k limita a clique em |C| + k, então só os vértices de cor alta são ramificados, do
+// último para o primeiro, e a busca volta assim que |C| + k não supera a melhor clique.
+// A clique gulosa de graph_clique_lower_bound é a solução inicial.
+
+typedef struct {
+    uint64_t *candidates; // P neste nível
+    int *vertices;        // Vértices de P na ordem da coloração
+    int *color;           // Cor (limite) de cada um
+} CliqueLevel;
+
+typedef struct {
+    int n;
+    int words;
+    uint64_t *adj;        // Linhas na numeração smallest-last
+    const int *order;     // order[i]: vértice original na posição i
+    CliqueLevel *levels;  // Alocados na primeira vez que a busca chega a cada profundidade
+    int num_levels;
+    int *current;         // Clique atual (posições)
+    int *best;            // Melhor clique (posições)
+    int best_size;
+    long long nodes;
+    double deadline;
+    bool stopped;         // Prazo atingido
+} CliqueSearch;
+
+static double wall_time(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static CliqueLevel *clique_level(CliqueSearch *s, int depth) {
+    if (depth >= s->num_levels) {
+        s->levels[depth].candidates = (uint64_t *)malloc(s->words * sizeof(uint64_t));
+        s->levels[depth].vertices = (int *)malloc(s->n * sizeof(int));
+        s->levels[depth].color = (int *)malloc(s->n * sizeof(int));
+        if (s->levels[depth].candidates == NULL || s->levels[depth].vertices == NULL ||
+            s->levels[depth].color == NULL) {
+            perror("Erro ao alocar memória para a busca de clique máxima");
+            exit(EXIT_FAILURE);
+        }
+        s->num_levels = depth + 1;
+    }
+    return &s->levels[depth];
+}
+
+// Colore P gulosamente e guarda em level->vertices só os vértices cuja cor pode melhorar a
+// melhor clique (cor > best_size - depth), em ordem crescente de cor. Retorna quantos são.
+static int clique_color_bound(CliqueSearch *s, CliqueLevel *level, int depth, uint64_t *uncolored, uint64_t *class_bits) {
+    int words = s->words;
+    int min_color = s->best_size - depth + 1; // Cores menores não levam a uma clique maior
+    int count = 0;
+    for (int w = 0; w < words; w++) {
+        uncolored[w] = level->candidates[w];
+    }
+    int k = 0;
+    bool any = true;
+    while (any) {
+        k++;
+        for (int w = 0; w < words; w++) {
+            class_bits[w] = uncolored[w];
+        }
+        for (int w = 0; w < words; w++) {
+            while (class_bits[w]) {
+                int v = w * 64 + __builtin_ctzll(class_bits[w]);
+                // v entra na classe k: sai dos não coloridos, e os vizinhos dele saem da classe
+                uncolored[w] &= ~(1ULL << (v & 63));
+                class_bits[w] &= ~(1ULL << (v & 63));
+                const uint64_t *row = s->adj + (size_t)v * words;
+                for (int x = w; x < words; x++) {
+                    class_bits[x] &= ~row[x];
+                }
+                if (k >= min_color) {
+                    level->vertices[count] = v;
+                    level->color[count] = k;
+                    count++;
+                }
+            }
+        }
+        any = false;
+        for (int w = 0; w < words && !any; w++) {
+            any = uncolored[w] != 0;
+        }
+    }
+    return count;
+}
+
+static void clique_expand(CliqueSearch *s, int depth, uint64_t *scratch) {
+    CliqueLevel *level = &s->levels[depth];
+    int words = s->words;
+    int count = clique_color_bound(s, level, depth, scratch, scratch + words);
+
+    for (int i = count - 1; i >= 0; i--) {
+        if (depth + level->color[i] <= s->best_size || s->stopped) return;
+        if ((++s->nodes & 1023) == 0 && wall_time() >= s->deadline) {
+            s->stopped = true;
+            return;
+        }
+        int v = level->vertices[i];
+        s->current[depth] = v;
+
+        // Novos candidatos: P AND vizinhos de v
+        CliqueLevel *next = clique_level(s, depth + 1);
+        const uint64_t *row = s->adj + (size_t)v * words;
+        bool empty = true;
+        for (int w = 0; w < words; w++) {
+            next->candidates[w] = level->candidates[w] & row[w];
+            empty = empty && next->candidates[w] == 0;
+        }
+        if (empty) {
+            if (depth + 1 > s->best_size) {
+                s->best_size = depth + 1;
+                for (int j = 0; j <= depth; j++) {
+                    s->best[j] = s->current[j];
+                }
+            }
+        } else {
+            clique_expand(s, depth + 1, scratch);
+        }
+        level->candidates[v >> 6] &= ~(1ULL << (v & 63));
+    }
+}
+
+int maximum_clique(Graph *graph, CliqueMode mode, double time_limit, int *clique, bool *proven) {
+    const int *greedy;
+    int greedy_size = graph_clique_lower_bound(graph, &greedy);
+    int n = graph->num_vertices;
+    if (mode == CLIQUE_GREEDY || n == 0) {
+        if (clique != NULL) {
+            for (int i = 0; i < greedy_size; i++) {
+                clique[i] = greedy[i];
+            }
+        }
+        if (proven != NULL) {
+            *proven = n == 0;
+        }
+        return greedy_size;
+    }
+
+    CliqueSearch s = { 0 };
+    s.n = n;
+    s.words = (n + 63) / 64;
+    s.order = graph_smallest_last_order(graph);
+    s.deadline = wall_time() + time_limit;
+    int *position = (int *)malloc(n * sizeof(int));
+    s.adj = (uint64_t *)calloc((size_t)n * s.words, sizeof(uint64_t));
+    s.levels = (CliqueLevel *)calloc((size_t)graph_degeneracy(graph) + 2, sizeof(CliqueLevel));
+    s.current = (int *)malloc(n * sizeof(int));
+    s.best = (int *)malloc(n * sizeof(int));
+    uint64_t *scratch = (uint64_t *)malloc(2 * (size_t)s.words * sizeof(uint64_t));
+    if (position == NULL || s.adj == NULL || s.levels == NULL || s.current == NULL || s.best == NULL ||
+        scratch == NULL) {
+        perror("Erro ao alocar memória para a busca de clique máxima");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < n; i++) {
+        position[s.order[i]] = i;
+    }
+    for (int v = 0; v < n; v++) {
+        int pv = position[v];
+        int u;
+        for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &u);) {
+            int pu = position[u];
+            s.adj[(size_t)pv * s.words + (pu >> 6)] |= 1ULL << (pu & 63);
+        }
+    }
+    s.best_size = greedy_size;
+    for (int i = 0; i < greedy_size; i++) {
+        s.best[i] = position[greedy[i]];
+    }
+
+    // Nível 0: todos os vértices são candidatos. A profundidade nunca passa de degeneracy + 1,
+    // o tamanho máximo de uma clique.
+    CliqueLevel *root = clique_level(&s, 0);
+    for (int w = 0; w < s.words; w++) {
+        root->candidates[w] = 0;
+    }
+    for (int v = 0; v < n; v++) {
+        root->candidates[v >> 6] |= 1ULL << (v & 63);
+    }
+    clique_expand(&s, 0, scratch);
+
+    if (clique != NULL) {
+        for (int i = 0; i < s.best_size; i++) {
+            clique[i] = s.order[s.best[i]];
+        }
+    }
+    if (proven != NULL) {
+        *proven = !s.stopped;
+    }
+    int size = s.best_size;
+
+    for (int d = 0; d < s.num_levels; d++) {
+        free(s.levels[d].candidates);
+        free(s.levels[d].vertices);
+        free(s.levels[d].color);
+    }
+    free(s.levels);
+    free(position);
+    free(s.adj);
+    free(s.current);
+    free(s.best);
+    free(scratch);
+
+    return size;
+}
@@ -0,0 +1,781 @@
+#include <stdio.h>   // Para perror
+#include <stdlib.h>  // Para alocação de memória (malloc, calloc, free, exit)
+#include <string.h>  // Para memset, memcpy
+
+#include "coloring.h"
+
+// --- Núcleo First Fit ---
+
+bool first_fit_init(FirstFitScratch *scratch, int max_degree) {
+    scratch->max_color = max_degree + 1;
+    scratch->words = max_degree / 64 + 1;
+    scratch->top = -1;
+    scratch->mask = (uint64_t *)calloc(scratch->words, sizeof(uint64_t));
+    return scratch->mask != NULL;
+}
+
+void first_fit_free(FirstFitScratch *scratch) {
+    free(scratch->mask);
+    scratch->mask = NULL;
+}
+
+int first_fit_pick(FirstFitScratch *scratch, Graph *graph, const int *colors, int v) {
+    int neighbor;
+    if (scratch->words == 1) {
+        // Até 64 cores possíveis: o conjunto inteiro cabe num registrador. v tem no máximo 63
+        // vizinhos, então sempre sobra um bit zero.
+        uint64_t used = 0;
+        for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &neighbor);) {
+            unsigned bit = (unsigned)colors[neighbor] - 1; // Não colorido (0) vira UINT_MAX
+            if (bit < 64) {
+                used |= 1ULL << bit;
+            }
+        }
+        return __builtin_ctzll(~used) + 1;
+    }
+
+    // Percorre apenas os vizinhos reais; cores acima de max_color nunca seriam escolhidas
+    for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &neighbor);) {
+        first_fit_forbid(scratch, colors[neighbor]);
+    }
+    return first_fit_take(scratch);
+}
+
+int greedy_coloring_in_order(Graph *graph, const int *order, int *colors) {
+    int n = graph->num_vertices;
+    for (int i = 0; i < n; i++) {
+        colors[i] = 0;
+    }
+
+    FirstFitScratch scratch;
+    if (!first_fit_init(&scratch, graph_max_degree(graph))) {
+        perror("Erro ao alocar memória para o First Fit");
+        exit(EXIT_FAILURE);
+    }
+
+    int max_colors_used = 0;
+    for (int i = 0; i < n; i++) {
+        int v = order ? order[i] : i;
+        int chosen_color = first_fit_pick(&scratch, graph, colors, v);
+        colors[v] = chosen_color;
+        if (chosen_color > max_colors_used) {
+            max_colors_used = chosen_color;
+        }
+    }
+
+    first_fit_free(&scratch);
+    return max_colors_used;
+}
+
+// --- Verificação de Colorações ---
+
+bool coloring_is_valid(Graph *graph, const int *colors) {
+    int n = graph->num_vertices;
+    for (int v = 0; v < n; v++) {
+        if (colors[v] < 1) {
+            return false;
+        }
+        int u;
+        for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &u);) {
+            if (colors[u] == colors[v]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// --- Algoritmo First Fit para Coloração de Vértices ---
+
+// Implementa o algoritmo First Fit para colorir um grafo.
+// graph: Ponteiro para a estrutura Graph.
+// colors: Um array de inteiros (alocado pelo chamador) onde as cores de cada vértice serão armazenadas.
+//         colors[i] conterá a cor do vértice i.
+// Retorna o número total de cores utilizadas.
+int first_fit_coloring(Graph *graph, int *colors) {
+    // Percorre cada vértice em ordem sequencial (0, 1, ..., N-1)
+    return greedy_coloring_in_order(graph, NULL, colors);
+}
+
+// --- Funções Auxiliares para os Algoritmos Baseados em Grau ---
+
+// Função de comparação para qsort: ordena VertexDegree em ordem decrescente de grau.
+int compare_vertex_degree(const void *a, const void *b) {
+    int da = ((const VertexDegree *)a)->degree;
+    int db = ((const VertexDegree *)b)->degree;
+    return (da < db) - (da > db);
+}
+
+// Calcula o grau de todos os vértices do grafo (lidos da análise em cache, graph_degrees).
+// graph: Ponteiro para a estrutura Graph.
+// degrees: Um array de VertexDegree (alocado pelo chamador) onde os IDs e graus serão armazenados.
+void calculate_all_degrees(Graph *graph, VertexDegree *degrees) {
+    const int *degree = graph_degrees(graph);
+    for (int i = 0; i < graph->num_vertices; i++) {
+        degrees[i].id = i;
+        degrees[i].degree = degree[i];
+    }
+}
+
+// --- Algoritmo Welsh-Powell para Coloração de Vértices ---
+
+// Implementa o algoritmo Welsh-Powell para colorir um grafo.
+// A cada cor, os vértices ainda não coloridos são percorridos em ordem decrescente de grau, e
+// cada um entra na classe se nenhum vizinho já estiver nela. Os vizinhos da classe ficam numa
+// máscara "proibido para a cor atual", atualizada quando um vértice entra na classe (OR da linha
+// na matriz de bits, carimbo da cor nas listas), então testar um candidato custa O(1). Os que
+// não entram são compactados, na mesma ordem, para a próxima cor.
+// graph: Ponteiro para a estrutura Graph.
+// colors: Um array de inteiros (alocado pelo chamador) onde as cores de cada vértice serão armazenadas.
+//         colors[i] conterá a cor do vértice i.
+// Retorna o número total de cores utilizadas.
+int welsh_powell_coloring(Graph *graph, int *colors) {
+    int n = graph->num_vertices;
+
+    // Inicializa todas as cores dos vértices como 0 (não colorido)
+    for (int i = 0; i < n; i++) {
+        colors[i] = 0;
+    }
+
+    // Passo 1: Vértices não coloridos, em ordem decrescente de grau
+    int *remaining = (int *)malloc(n * sizeof(int));
+    if (remaining == NULL) {
+        perror("Erro ao alocar memória para remaining");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(remaining, graph_degree_order(graph), n * sizeof(int));
+
+    // Máscara dos vértices proibidos para a cor atual: bits na matriz de bits, carimbos
+    // (forbidden[u] == cor atual) nas listas
+    uint64_t *forbidden_bits = NULL;
+    int *forbidden = NULL;
+    if (graph->layout == GRAPH_LAYOUT_BITSET) {
+        forbidden_bits = (uint64_t *)malloc((graph->words_per_row + 1) * sizeof(uint64_t));
+    } else {
+        forbidden = (int *)calloc(n, sizeof(int));
+    }
+    if (forbidden_bits == NULL && forbidden == NULL) {
+        perror("Erro ao alocar memória para a máscara de proibidos");
+        free(remaining);
+        exit(EXIT_FAILURE);
+    }
+
+    int current_color = 0;
+    int num_remaining = n;
+
+    // Continua enquanto houver vértices não coloridos
+    while (num_remaining > 0) {
+        current_color++;
+        if (forbidden_bits != NULL) {
+            memset(forbidden_bits, 0, graph->words_per_row * sizeof(uint64_t));
+        }
+
+        // Passo 2 e 3: o primeiro não colorido (maior grau) inicia a classe, e cada vértice
+        // seguinte entra nela se não for vizinho de nenhum vértice já na classe
+        int kept = 0;
+        for (int i = 0; i < num_remaining; i++) {
+            int v = remaining[i];
+            bool admissible = forbidden_bits != NULL ? !(forbidden_bits[v >> 6] >> (v & 63) & 1)
+                                                     : forbidden[v] != current_color;
+            if (!admissible) {
+                remaining[kept++] = v;
+                continue;
+            }
+
+            colors[v] = current_color;
+            if (forbidden_bits != NULL) {
+                const uint64_t *row = adj_bits_row(graph, v);
+                for (int w = 0; w < graph->words_per_row; w++) {
+                    forbidden_bits[w] |= row[w];
+                }
+            } else {
+                int u;
+                for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &u);) {
+                    forbidden[u] = current_color;
+                }
+            }
+        }
+        num_remaining = kept;
+    }
+
+    free(remaining);
+    free(forbidden_bits);
+    free(forbidden);
+
+    return current_color;
+}
+
+// --- Algoritmo Largest Degree Ordering (LDO) para Coloração de Vértices ---
+
+// Implementa o algoritmo Largest Degree Ordering (LDO) para colorir um grafo.
+// graph: Ponteiro para a estrutura Graph.
+// colors: Um array de inteiros (alocado pelo chamador) onde as cores de cada vértice serão armazenadas.
+//         colors[i] conterá a cor do vértice i.
+// Retorna o número total de cores utilizadas.
+int largest_degree_ordering_coloring(Graph *graph, int *colors) {
+    // Passo 1: Vértices em ordem decrescente de grau (calculada uma vez por grafo)
+    const int *order = graph_degree_order(graph);
+
+    // Passo 2 e 3: Iterar pelos vértices na ordem de maior grau e aplicar First Fit
+    return greedy_coloring_in_order(graph, order, colors);
+}
+
+// --- Heap de Vértices para IDO, DSATUR e RLF ---
+
+// Heap de máximo indexado com os vértices não coloridos, ordenado por (key, grau, -id): o topo
+// é o vértice de maior chave, desempatado pelo maior grau e depois pelo menor índice, que é o
+// critério das varreduras originais do IDO, do DSATUR e do RLF. A chave só cresce (vertex_heap_up).
+typedef struct {
+    int *heap;           // Vértices na ordem do heap
+    int *pos;            // Posição de cada vértice no heap (-1 se já saiu)
+    int size;
+    const int *key;      // Chave principal (incidência no IDO, saturação no DSATUR, vizinhos em U no RLF)
+    const int *degree;
+} VertexHeap;
+
+static inline bool vertex_heap_before(const VertexHeap *h, int a, int b) {
+    if (h->key[a] != h->key[b]) return h->key[a] > h->key[b];
+    if (h->degree[a] != h->degree[b]) return h->degree[a] > h->degree[b];
+    return a < b;
+}
+
+static void vertex_heap_up(VertexHeap *h, int i) {
+    int v = h->heap[i];
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        int p = h->heap[parent];
+        if (!vertex_heap_before(h, v, p)) break;
+        h->heap[i] = p;
+        h->pos[p] = i;
+        i = parent;
+    }
+    h->heap[i] = v;
+    h->pos[v] = i;
+}
+
+static void vertex_heap_down(VertexHeap *h, int i) {
+    int v = h->heap[i];
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= h->size) break;
+        if (child + 1 < h->size && vertex_heap_before(h, h->heap[child + 1], h->heap[child])) {
+            child++;
+        }
+        int c = h->heap[child];
+        if (!vertex_heap_before(h, c, v)) break;
+        h->heap[i] = c;
+        h->pos[c] = i;
+        i = child;
+    }
+    h->heap[i] = v;
+    h->pos[v] = i;
+}
+
+// Retira v do heap, de qualquer posição
+static void vertex_heap_remove(VertexHeap *h, int v) {
+    int i = h->pos[v];
+    h->pos[v] = -1;
+    h->size--;
+    if (i < h->size) {
+        int last = h->heap[h->size];
+        h->heap[i] = last;
+        vertex_heap_up(h, i);
+        vertex_heap_down(h, h->pos[last]);
+    }
+}
+
+static int vertex_heap_pop(VertexHeap *h) {
+    int top = h->heap[0];
+    h->pos[top] = -1;
+    h->size--;
+    if (h->size > 0) {
+        h->heap[0] = h->heap[h->size];
+        vertex_heap_down(h, 0);
+    }
+    return top;
+}
+
+// --- Algoritmo Incidence Degree Ordering (IDO) para Coloração de Vértices ---
+
+// Fila de baldes do modo IDO_TIES_BUCKET: balde k = vértices não coloridos com k vizinhos
+// coloridos, em listas duplamente encadeadas. A cabeça de cada balde é o candidato dele.
+typedef struct {
+    int *head;  // Primeiro vértice de cada balde (-1 se vazio), baldes 0 .. max_degree
+    int *next;
+    int *prev;
+    int top;    // Maior balde possivelmente não vazio
+} IncidenceBuckets;
+
+static void incidence_buckets_remove(IncidenceBuckets *b, int v, int k) {
+    if (b->prev[v] >= 0) {
+        b->next[b->prev[v]] = b->next[v];
+    } else {
+        b->head[k] = b->next[v];
+    }
+    if (b->next[v] >= 0) {
+        b->prev[b->next[v]] = b->prev[v];
+    }
+}
+
+// Insere v no balde k. Para desempatar por grau sem perder O(1), v vira a cabeça só se tiver
+// grau maior (ou igual e índice menor) que a cabeça atual; senão entra logo depois dela.
+static void incidence_buckets_insert(IncidenceBuckets *b, int v, int k, const int *degree) {
+    int h = b->head[k];
+    if (h < 0 || degree[v] > degree[h] || (degree[v] == degree[h] && v < h)) {
+        b->prev[v] = -1;
+        b->next[v] = h;
+        if (h >= 0) b->prev[h] = v;
+        b->head[k] = v;
+    } else {
+        b->prev[v] = h;
+        b->next[v] = b->next[h];
+        if (b->next[h] >= 0) b->prev[b->next[h]] = v;
+        b->next[h] = v;
+    }
+    if (k > b->top) {
+        b->top = k;
+    }
+}
+
+// Implementa o algoritmo Incidence Degree Ordering (IDO) para colorir um grafo.
+// O grau de incidência (vizinhos já coloridos) de cada vértice é um contador, incrementado
+// quando um vizinho é colorido, e o próximo vértice sai de uma fila de prioridade:
+//   IDO_TIES_EXACT:  heap por (incidência, grau, -índice), O((n + m) log n). Reproduz exatamente
+//                    a varredura original (maior incidência, maior grau, menor índice).
+//   IDO_TIES_BUCKET: fila de baldes por incidência, O(n + m). O empate por grau é aproximado
+//                    (ver incidence_buckets_insert), então a coloração pode diferir.
+// O limite linear só vale no modo aproximado. Baldes por (incidência, grau) não bastariam para o
+// exato: dentro de um balde ainda falta o menor índice, e um vértice que sobe de balde teria de
+// entrar na posição certa da lista.
+// graph: Ponteiro para a estrutura Graph.
+// colors: Um array de inteiros (alocado pelo chamador) onde as cores de cada vértice serão armazenadas.
+//         colors[i] conterá a cor do vértice i.
+// Retorna o número total de cores utilizadas.
+int incidence_degree_ordering_coloring_mode(Graph *graph, int *colors, IdoTieBreak ties) {
+    int n = graph->num_vertices;
+    for (int i = 0; i < n; i++) {
+        colors[i] = 0;
+    }
+    if (n == 0) {
+        return 0;
+    }
+
+    const int *degree = graph_degrees(graph);
+    int max_degree = graph_max_degree(graph);
+    int *incidence = (int *)calloc(n, sizeof(int));
+    int *heap = (int *)malloc(n * sizeof(int));
+    int *pos = (int *)malloc(n * sizeof(int));
+    if (incidence == NULL || heap == NULL || pos == NULL) {
+        perror("Erro ao alocar memória para o IDO");
+        exit(EXIT_FAILURE);
+    }
+
+    FirstFitScratch scratch;
+    if (!first_fit_init(&scratch, max_degree)) {
+        perror("Erro ao alocar memória para o First Fit no IDO");
+        exit(EXIT_FAILURE);
+    }
+
+    VertexHeap h = { heap, pos, n, incidence, degree };
+    IncidenceBuckets b = { NULL, heap, pos, 0 };
+    if (ties == IDO_TIES_EXACT) {
+        for (int v = 0; v < n; v++) {
+            heap[v] = v;
+            pos[v] = v;
+        }
+        for (int i = n / 2 - 1; i >= 0; i--) {
+            vertex_heap_down(&h, i);
+        }
+    } else {
+        // Sem heap, os vetores heap e pos servem de next e prev das listas
+        b.head = (int *)malloc((max_degree + 1) * sizeof(int));
+        if (b.head == NULL) {
+            perror("Erro ao alocar memória para os baldes do IDO");
+            exit(EXIT_FAILURE);
+        }
+        for (int k = 0; k <= max_degree; k++) {
+            b.head[k] = -1;
+        }
+        // Balde 0 em ordem decrescente de grau, índices crescentes no empate: inserir do último
+        // para o primeiro pela cabeça deixa essa ordem na lista
+        const int *sorted = graph_degree_order(graph);
+        for (int i = n - 1; i >= 0; i--) {
+            int v = sorted[i];
+            b.prev[v] = -1;
+            b.next[v] = b.head[0];
+            if (b.head[0] >= 0) b.prev[b.head[0]] = v;
+            b.head[0] = v;
+        }
+    }
+
+    bool *is_colored = (bool *)calloc(n, sizeof(bool));
+    if (is_colored == NULL) {
+        perror("Erro ao alocar memória para is_colored no IDO");
+        exit(EXIT_FAILURE);
+    }
+
+    int max_colors_used = 0;
+    for (int colored_count = 0; colored_count < n; colored_count++) {
+        int v;
+        if (ties == IDO_TIES_EXACT) {
+            v = vertex_heap_pop(&h);
+        } else {
+            while (b.head[b.top] < 0) {
+                b.top--;
+            }
+            v = b.head[b.top];
+            incidence_buckets_remove(&b, v, b.top);
+        }
+        is_colored[v] = true;
+
+        int chosen_color = first_fit_pick(&scratch, graph, colors, v);
+        colors[v] = chosen_color;
+        if (chosen_color > max_colors_used) {
+            max_colors_used = chosen_color;
+        }
+
+        // Cada vizinho não colorido ganha um vizinho colorido
+        int u;
+        for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &u);) {
+            if (is_colored[u]) {
+                continue;
+            }
+            if (ties == IDO_TIES_EXACT) {
+                incidence[u]++;
+                vertex_heap_up(&h, pos[u]);
+            } else {
+                incidence_buckets_remove(&b, u, incidence[u]);
+                incidence[u]++;
+                incidence_buckets_insert(&b, u, incidence[u], degree);
+            }
+        }
+    }
+
+    free(incidence);
+    free(heap);
+    free(pos);
+    free(b.head);
+    free(is_colored);
+    first_fit_free(&scratch);
+
+    return max_colors_used;
+}
+
+int incidence_degree_ordering_coloring(Graph *graph, int *colors) {
+    return incidence_degree_ordering_coloring_mode(graph, colors, IDO_TIES_EXACT);
+}
+
+// --- Algoritmo Degree of Saturation (DSATUR) para Coloração de Vértices ---
+
+// Implementa o algoritmo DSATUR para colorir um grafo.
+// Cada vértice não colorido guarda o conjunto (em bits) das cores de seus vizinhos já coloridos;
+// ao colorir v, só os vizinhos de v são atualizados, e a saturação deles sobe no heap. A escolha
+// segue o critério original (saturação, depois grau, depois menor índice) e a cor é a menor
+// ausente do conjunto, então a coloração é a mesma da varredura O(n^2) por passo.
+// graph: Ponteiro para a estrutura Graph.
+// colors: Um array de inteiros (alocado pelo chamador) onde as cores de cada vértice serão armazenadas.
+//         colors[i] conterá a cor do vértice i.
+// Retorna o número total de cores utilizadas.
+int dsatur_coloring(Graph *graph, int *colors) {
+    int n = graph->num_vertices;
+    for (int i = 0; i < n; i++) {
+        colors[i] = 0;
+    }
+    if (n == 0) {
+        return 0;
+    }
+
+    const int *degree = graph_degrees(graph);
+    int *saturation = (int *)calloc(n, sizeof(int));
+    int *heap = (int *)malloc(n * sizeof(int));
+    int *pos = (int *)malloc(n * sizeof(int));
+    // Cores vizinhas: a cor c é o bit c - 1 da linha do vértice. As linhas crescem (dobrando
+    // words_per_row) conforme novas cores aparecem, então a memória é n * cores usadas / 8 bytes.
+    int words_per_row = 1;
+    uint64_t *neighbor_colors = (uint64_t *)calloc(n, sizeof(uint64_t));
+    if (saturation == NULL || heap == NULL || pos == NULL || neighbor_colors == NULL) {
+        perror("Erro ao alocar memória para o DSATUR");
+        exit(EXIT_FAILURE);
+    }
+
+    VertexHeap h = { heap, pos, n, saturation, degree };
+    for (int v = 0; v < n; v++) {
+        heap[v] = v;
+        pos[v] = v;
+    }
+    for (int i = n / 2 - 1; i >= 0; i--) {
+        vertex_heap_down(&h, i);
+    }
+
+    int max_colors_used = 0;
+    while (h.size > 0) {
+        int v = vertex_heap_pop(&h);
+
+        // Menor cor ausente entre os vizinhos coloridos: primeiro bit zero da linha de v
+        int chosen_color = color_mask_first_free(neighbor_colors + (size_t)v * words_per_row, words_per_row);
+        colors[v] = chosen_color;
+        if (chosen_color > max_colors_used) {
+            max_colors_used = chosen_color;
+        }
+
+        // Nova cor além da largura atual: dobra as linhas de todos os vértices
+        int bit = chosen_color - 1;
+        if (bit >= words_per_row * 64) {
+            int new_words = words_per_row * 2;
+            uint64_t *grown = (uint64_t *)calloc((size_t)n * new_words, sizeof(uint64_t));
+            if (grown == NULL) {
+                perror("Erro ao alocar memória para as cores vizinhas no DSATUR");
+                exit(EXIT_FAILURE);
+            }
+            for (int u = 0; u < n; u++) {
+                memcpy(grown + (size_t)u * new_words, neighbor_colors + (size_t)u * words_per_row,
+                       words_per_row * sizeof(uint64_t));
+            }
+            free(neighbor_colors);
+            neighbor_colors = grown;
+            words_per_row = new_words;
+        }
+
+        // Atualiza apenas os vizinhos ainda não coloridos para os quais a cor é nova
+        uint64_t mask = 1ULL << (bit & 63);
+        int u;
+        for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &u);) {
+            if (pos[u] < 0) {
+                continue;
+            }
+            uint64_t *word = neighbor_colors + (size_t)u * words_per_row + (bit >> 6);
+            if (!(*word & mask)) {
+                *word |= mask;
+                saturation[u]++;
+                vertex_heap_up(&h, pos[u]);
+            }
+        }
+    }
+
+    free(saturation);
+    free(heap);
+    free(pos);
+    free(neighbor_colors);
+
+    return max_colors_used;
+}
+
+// --- Algoritmo Recursive Largest First (RLF) para Coloração de Vértices ---
+
+// Estado do RLF. Cada cor é uma classe independente construída vértice a vértice: U são os
+// vizinhos (coloridos ou não) dos vértices da classe e V' os candidatos, não coloridos fora de U.
+// O próximo vértice da classe é o candidato com mais vizinhos em U (neighbors_in_U), desempatado
+// pelo maior grau e depois pelo menor índice: o topo de um VertexHeap com V'. Os contadores só
+// mudam quando U cresce, e só a partir dos vértices que acabaram de entrar em U.
+typedef struct {
+    Graph *graph;
+    int *colors;
+    const int *degree;
+    int *neighbors_in_U;
+    int *candidates;     // Não coloridos no início da cor
+    VertexHeap heap;     // V' ordenado por (vizinhos em U, grau, -índice)
+    int *in_U;           // in_U[v] == cor atual: v está em U (listas)
+    const uint64_t *rows; // Linhas de adjacência em bits (NULL: listas)
+    size_t row_stride;   // Palavras entre linhas de rows
+    int words;           // Palavras por conjunto de vértices
+    uint64_t *own_rows;  // Linhas montadas aqui (NULL se rows é a matriz do grafo)
+    uint64_t *U_bits;    // U em bits
+    uint64_t *added_bits; // Vértices que acabaram de entrar em U
+    uint64_t *candidate_bits; // V' em bits
+} RlfState;
+
+// Põe os candidatos no heap, todos com zero vizinhos em U
+static void rlf_heap_init(RlfState *s, int num_candidates) {
+    VertexHeap *h = &s->heap;
+    h->size = 0;
+    for (int i = 0; i < num_candidates; i++) {
+        int y = s->candidates[i];
+        s->neighbors_in_U[y] = 0;
+        h->heap[h->size] = y;
+        h->pos[y] = h->size++;
+    }
+    for (int i = h->size / 2 - 1; i >= 0; i--) {
+        vertex_heap_down(h, i);
+    }
+}
+
+// Listas: quando x entra em U, cada candidato vizinho de x ganha um vizinho em U e sobe no heap.
+// Cada vértice entra em U no máximo uma vez por cor, então construir uma classe custa
+// O(m log n) no pior caso e, em grafos esparsos, bem menos.
+static int rlf_build_class_lists(RlfState *s, int num_candidates, int color) {
+    Graph *graph = s->graph;
+    VertexHeap *h = &s->heap;
+    rlf_heap_init(s, num_candidates);
+
+    int class_size = 0;
+    while (h->size > 0) {
+        int v = vertex_heap_pop(h);
+        s->colors[v] = color;
+        class_size++;
+
+        int x;
+        for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &x);) {
+            if (s->in_U[x] == color) {
+                continue;
+            }
+            s->in_U[x] = color;
+            if (h->pos[x] >= 0) {
+                vertex_heap_remove(h, x);
+            }
+            int y;
+            for (NeighborIter it_x = graph_neighbors(graph, x); neighbor_next(&it_x, &y);) {
+                if (h->pos[y] >= 0) {
+                    s->neighbors_in_U[y]++;
+                    vertex_heap_up(h, h->pos[y]);
+                }
+            }
+        }
+    }
+    return class_size;
+}
+
+// Matriz de bits: os vértices novos de U formam added_bits (linha de v AND NOT U). Quem estava
+// em V' e entrou em U sai do heap; cada candidato restante soma popcount(linha AND added_bits),
+// 64 vértices novos por palavra, e sobe no heap uma vez se o contador mudou. Nos grafos densos
+// uma classe junta poucos vértices e quase todos os candidatos ganham vizinhos em U a cada um,
+// então contar em bits sai mais barato que seguir listas vizinho a vizinho.
+static int rlf_build_class_bits(RlfState *s, int num_candidates, int color) {
+    VertexHeap *h = &s->heap;
+    int words = s->words;
+    rlf_heap_init(s, num_candidates);
+    memset(s->U_bits, 0, words * sizeof(uint64_t));
+    memset(s->candidate_bits, 0, words * sizeof(uint64_t));
+    for (int i = 0; i < num_candidates; i++) {
+        int y = s->candidates[i];
+        s->candidate_bits[y >> 6] |= 1ULL << (y & 63);
+    }
+
+    int class_size = 0;
+    while (h->size > 0) {
+        int v = vertex_heap_pop(h);
+        s->colors[v] = color;
+        s->candidate_bits[v >> 6] &= ~(1ULL << (v & 63));
+        class_size++;
+
+        const uint64_t *row = s->rows + (size_t)v * s->row_stride;
+        for (int w = 0; w < words; w++) {
+            uint64_t added = row[w] & ~s->U_bits[w];
+            s->added_bits[w] = added;
+            s->U_bits[w] |= added;
+            uint64_t leaving = added & s->candidate_bits[w];
+            s->candidate_bits[w] &= ~leaving;
+            while (leaving) {
+                vertex_heap_remove(h, w * 64 + __builtin_ctzll(leaving));
+                leaving &= leaving - 1;
+            }
+        }
+
+        // Cada candidato restante soma os vizinhos que ganhou em U e sobe no heap
+        for (int w = 0; w < words; w++) {
+            uint64_t remaining = s->candidate_bits[w];
+            while (remaining) {
+                int y = w * 64 + __builtin_ctzll(remaining);
+                remaining &= remaining - 1;
+                int gained = bitset_and_count(s->rows + (size_t)y * s->row_stride, s->added_bits, words);
+                if (gained > 0) {
+                    s->neighbors_in_U[y] += gained;
+                    vertex_heap_up(h, h->pos[y]);
+                }
+            }
+        }
+    }
+    return class_size;
+}
+
+// Implementa o algoritmo Recursive Largest First (RLF) para colorir um grafo.
+// Cada classe começa pelo vértice não colorido de maior grau (o melhor candidato quando ninguém
+// tem vizinhos em U) e cresce até V' esvaziar. Grafos densos (os que graph_choose_layout põe na
+// matriz de bits) contam os vizinhos em U em bits: com a matriz do grafo ou, se ele estiver em
+// outra representação, com linhas montadas aqui (que ocupam menos que as listas, pela própria
+// escolha da representação). Os esparsos seguem as listas (ver acima).
+// graph: Ponteiro para a estrutura Graph.
+// colors: Um array de inteiros (alocado pelo chamador) onde as cores de cada vértice serão armazenadas.
+//         colors[i] conterá a cor do vértice i.
+// Retorna o número total de cores utilizadas.
+int recursive_largest_first_coloring(Graph *graph, int *colors) {
+    int n = graph->num_vertices;
+    for (int i = 0; i < n; i++) {
+        colors[i] = 0;
+    }
+
+    bool dense = graph->layout == GRAPH_LAYOUT_BITSET ||
+                 graph_choose_layout(n, graph->num_arestas) == GRAPH_LAYOUT_BITSET;
+    RlfState s = { 0 };
+    s.graph = graph;
+    s.colors = colors;
+    s.degree = graph_degrees(graph);
+    s.neighbors_in_U = (int *)malloc(n * sizeof(int));
+    s.candidates = (int *)malloc(n * sizeof(int));
+    s.heap.heap = (int *)malloc(n * sizeof(int));
+    s.heap.pos = (int *)malloc(n * sizeof(int));
+    s.heap.key = s.neighbors_in_U;
+    s.heap.degree = s.degree;
+    bool failed = s.neighbors_in_U == NULL || s.candidates == NULL || s.heap.heap == NULL || s.heap.pos == NULL;
+    if (dense) {
+        s.words = (n + 63) / 64;
+        if (graph->layout == GRAPH_LAYOUT_BITSET) {
+            s.rows = graph->adj_bits;
+            s.row_stride = graph->bits_stride;
+        } else {
+            s.own_rows = (uint64_t *)calloc((size_t)n * s.words + 1, sizeof(uint64_t));
+            failed = failed || s.own_rows == NULL;
+            for (int v = 0; !failed && v < n; v++) {
+                int u;
+                for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &u);) {
+                    s.own_rows[(size_t)v * s.words + (u >> 6)] |= 1ULL << (u & 63);
+                }
+            }
+            s.rows = s.own_rows;
+            s.row_stride = s.words;
+        }
+        s.U_bits = (uint64_t *)malloc((s.words + 1) * sizeof(uint64_t));
+        s.added_bits = (uint64_t *)malloc((s.words + 1) * sizeof(uint64_t));
+        s.candidate_bits = (uint64_t *)malloc((s.words + 1) * sizeof(uint64_t));
+        failed = failed || s.U_bits == NULL || s.added_bits == NULL || s.candidate_bits == NULL;
+    } else {
+        s.in_U = (int *)calloc(n, sizeof(int));
+        failed = failed || s.in_U == NULL;
+    }
+    if (failed) {
+        perror("Erro ao alocar memória para o RLF");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < n; v++) {
+        s.heap.pos[v] = -1;
+    }
+
+    int colored_count = 0;
+    int current_color = 0;
+
+    // Loop principal: Continua enquanto houver vértices não coloridos
+    while (colored_count < n) {
+        current_color++;
+
+        int num_candidates = 0;
+        for (int v = 0; v < n; v++) {
+            if (colors[v] == 0) {
+                s.candidates[num_candidates++] = v;
+            }
+        }
+
+        colored_count += dense ? rlf_build_class_bits(&s, num_candidates, current_color)
+                               : rlf_build_class_lists(&s, num_candidates, current_color);
+    }
+
+    free(s.neighbors_in_U);
+    free(s.candidates);
+    free(s.heap.heap);
+    free(s.heap.pos);
+    free(s.in_U);
+    free(s.own_rows);
+    free(s.U_bits);
+    free(s.added_bits);
+    free(s.candidate_bits);
+
+    return current_color;
+}
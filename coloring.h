@@ -0,0 +1,202 @@
+#ifndef COLORING_H
+#define COLORING_H
+
+#include "graph.h"
+
+// --- Estrutura auxiliar para vértices e seus graus ---
+typedef struct {
+    int id;     // ID do vértice (0 a N-1)
+    int degree; // Grau do vértice
+} VertexDegree;
+
+// --- Funções Auxiliares para os Algoritmos Baseados em Grau ---
+
+// Função de comparação para qsort: ordena VertexDegree em ordem decrescente de grau.
+// Os algoritmos da biblioteca usam degree_ordering, que dá a mesma ordem em tempo linear.
+int compare_vertex_degree(const void *a, const void *b);
+
+// Calcula o grau de todos os vértices do grafo (degrees alocado pelo chamador; os graus vêm de
+// graph_degrees).
+void calculate_all_degrees(Graph *graph, VertexDegree *degrees);
+
+// --- Núcleo First Fit ---
+// Cores proibidas em mapa de bits: a cor c é o bit c - 1, em palavras de 64 bits. A menor cor
+// livre é o primeiro bit zero, achado com __builtin_ctzll uma palavra por vez em vez de uma cor
+// por vez. Usado pelo First Fit (e LDO, IDO, SL, paralelos) e pelas linhas do DSATUR.
+
+// Menor cor (>= 1) cujo bit é zero em mask[0 .. words - 1]; words * 64 + 1 se todas estão usadas.
+static inline int color_mask_first_free(const uint64_t *mask, int words) {
+    int w = 0;
+    while (w < words && mask[w] == ~0ULL) {
+        w++;
+    }
+    return w * 64 + (w < words ? __builtin_ctzll(~mask[w]) : 0) + 1;
+}
+
+// Um vértice de grau d sempre recebe uma cor em 1..d+1, logo bastam (max_degree + 1) bits. Só as
+// palavras marcadas (até `top`) são limpas depois de cada escolha, nada é alocado por vértice.
+typedef struct {
+    uint64_t *mask;   // Cores proibidas para o vértice atual
+    int words;        // Palavras em mask; com uma só, first_fit_pick usa um registrador
+    int top;          // Última palavra marcada (-1: mask toda zerada)
+    int max_color;    // max_degree + 1: maior cor que pode ser escolhida
+} FirstFitScratch;
+
+// Proíbe a cor c (0, "não colorido", e cores que nunca seriam escolhidas são ignoradas)
+static inline void first_fit_forbid(FirstFitScratch *scratch, int c) {
+    if (c != 0 && c <= scratch->max_color) {
+        int w = (c - 1) >> 6;
+        scratch->mask[w] |= 1ULL << ((c - 1) & 63);
+        if (w > scratch->top) scratch->top = w;
+    }
+}
+
+// Menor cor não proibida; limpa as marcas para o próximo vértice
+static inline int first_fit_take(FirstFitScratch *scratch) {
+    int chosen_color = color_mask_first_free(scratch->mask, scratch->top + 1);
+    for (int w = 0; w <= scratch->top; w++) {
+        scratch->mask[w] = 0;
+    }
+    scratch->top = -1;
+    return chosen_color;
+}
+
+// Aloca o buffer para grafos com grau máximo max_degree. Retorna false se faltar memória.
+bool first_fit_init(FirstFitScratch *scratch, int max_degree);
+void first_fit_free(FirstFitScratch *scratch);
+
+// Retorna a menor cor (>= 1) livre entre os vizinhos de v; colors[u] == 0 é "não colorido".
+int first_fit_pick(FirstFitScratch *scratch, Graph *graph, const int *colors, int v);
+
+// Colore os vértices na ordem dada (order == NULL: 0, 1, ..., n - 1) com First Fit.
+// Retorna o número de cores usadas.
+int greedy_coloring_in_order(Graph *graph, const int *order, int *colors);
+
+// --- Ordens de Vértices (ordering.c) ---
+// Preenchem `order` (num_vertices posições, alocado pelo chamador) com uma permutação dos
+// vértices, pronta para greedy_coloring_in_order.
+
+// Grau decrescente, empates pelo menor índice (counting sort estável, O(n + Δ)).
+void degree_ordering(Graph *graph, int *order);
+
+// Smallest-last: o vértice de menor grau no grafo restante é removido e vai para o fim da ordem
+// (fila de baldes, O(n + m)). Retorna a degeneração do grafo.
+int smallest_last_ordering(Graph *graph, int *order);
+
+// --- Análise do Grafo (analysis.c) ---
+// Calculada sob demanda na primeira chamada e guardada no grafo até free_graph, para que todos
+// os algoritmos rodados no mesmo grafo a compartilhem. Os vetores pertencem ao grafo.
+
+const int *graph_degrees(Graph *graph);
+int graph_max_degree(Graph *graph);
+const int *graph_degree_order(Graph *graph);        // Cópia de degree_ordering
+const int *graph_smallest_last_order(Graph *graph); // Cópia de smallest_last_ordering
+int graph_degeneracy(Graph *graph);
+
+// Componente conexa de cada vértice (0 .. *num_components - 1; num_components pode ser NULL).
+const int *graph_components(Graph *graph, int *num_components);
+
+// Tamanho de uma clique achada por busca gulosa a partir de cada vértice, limitada aos vizinhos
+// anteriores na ordem smallest-last: limite inferior do número cromático. Se `clique` não for
+// NULL, recebe os vértices dela.
+int graph_clique_lower_bound(Graph *graph, const int **clique);
+
+// --- Algoritmos de Coloração de Vértices ---
+// Todos recebem um array `colors` alocado pelo chamador com num_vertices posições,
+// onde colors[i] receberá a cor (1, 2, ...) do vértice i, e retornam o número de cores usadas.
+
+int first_fit_coloring(Graph *graph, int *colors);
+int welsh_powell_coloring(Graph *graph, int *colors);
+int largest_degree_ordering_coloring(Graph *graph, int *colors);
+int incidence_degree_ordering_coloring(Graph *graph, int *colors);
+int dsatur_coloring(Graph *graph, int *colors);
+int recursive_largest_first_coloring(Graph *graph, int *colors);
+int smallest_last_coloring(Graph *graph, int *colors);
+
+// True se todo vértice tem cor >= 1 e nenhuma aresta liga duas pontas da mesma cor, O(n + m).
+// Os algoritmos não chamam isto; é para os programas conferirem resultados (os paralelos, por
+// exemplo).
+bool coloring_is_valid(Graph *graph, const int *colors);
+
+// --- Algoritmos Paralelos (parallel.c) ---
+// num_threads <= 0 usa uma thread por CPU.
+
+// Jones-Plassmann: prioridades aleatórias; a cada rodada, todo vértice cujos vizinhos não
+// coloridos têm prioridade menor é colorido (First Fit), em paralelo. A coloração depende só de
+// `seed`, não do número de threads nem da ordem em que elas rodam.
+int jones_plassmann_coloring(Graph *graph, int *colors, int num_threads, uint64_t seed);
+
+// Ordem de prioridade decrescente do Jones-Plassmann com `seed` (num_vertices posições, alocado
+// pelo chamador): greedy_coloring_in_order nela dá a mesma coloração, sequencialmente.
+void jones_plassmann_order(Graph *graph, uint64_t seed, int *order);
+
+// Gebremedhin-Manne: as threads colorem blocos da ordem dada (order == NULL: ordem natural) com
+// First Fit ao mesmo tempo; os conflitos entre vizinhos são detectados em paralelo e só o vértice
+// que vem depois na ordem é recolorido na iteração seguinte. Com uma thread, é igual a
+// greedy_coloring_in_order; com várias, o resultado pode variar de uma execução para outra.
+int speculative_greedy_coloring(Graph *graph, const int *order, int *colors, int num_threads);
+
+// --- Melhoria de Colorações (improvement.c) ---
+// Recebem em `colors` uma coloração válida com cores 1, 2, ... (de qualquer algoritmo acima), a
+// melhoram por até time_limit segundos de tempo de parede e retornam o número de cores final.
+// A busca para antes se chegar ao tamanho da clique de graph_clique_lower_bound.
+
+// Iterated Greedy de Culberson: reordena as classes de cor (inversa, maiores primeiro ou
+// aleatória) e recolore com First Fit, O(n + m) por iteração. O número de cores nunca aumenta.
+int iterated_greedy_coloring(Graph *graph, int *colors, double time_limit, uint64_t seed);
+
+// TabuCol: achada uma k-coloração, tira a maior cor e busca uma (k-1)-coloração minimizando os
+// conflitos com busca tabu; para quando o prazo acaba durante uma k. Se time_to_k não for NULL
+// (num_colors + 1 posições, num_colors = cores da coloração recebida), time_to_k[k] recebe os
+// segundos até a primeira k-coloração, ou -1 se k não foi alcançada.
+int tabucol_coloring(Graph *graph, int *colors, double time_limit, uint64_t seed, double *time_to_k);
+
+// Algoritmo evolutivo híbrido (Galinier-Hao): cruzamento GPX e busca tabu no filho, com a
+// população dividida entre num_threads threads (<= 0: uma por CPU) que trocam os melhores
+// indivíduos em anel. Começa da coloração recebida (por exemplo, do RLF ou do DSATUR) e, como o
+// TabuCol, reduz k a cada coloração sem conflitos; time_to_k tem o mesmo formato. Com mais de
+// uma thread, o resultado depende de como elas se intercalam.
+int hybrid_evolutionary_coloring(Graph *graph, int *colors, double time_limit, int num_threads, uint64_t seed,
+                                 double *time_to_k);
+
+// --- Coloração Exata (exact.c) ---
+
+typedef struct {
+    int lower_bound;   // Limite inferior provado (a clique, ou upper_bound se optimal)
+    int upper_bound;   // Cores da melhor coloração achada
+    bool optimal;      // A busca terminou: upper_bound é o número cromático
+    long long nodes;   // Cores tentadas na busca
+    double seconds;    // Tempo de parede, incluindo as heurísticas iniciais
+} ExactColoringReport;
+
+// DSATUR com branch and bound (Brélaz), com matriz de bits e cores possíveis palavra a palavra.
+// Começa do melhor entre DSATUR e RLF e da clique de maximum_clique (com um décimo do prazo), e
+// para ao provar o ótimo ou ao atingir node_limit nós ou time_limit segundos; nesse caso, report
+// (se não for NULL) traz os limites provados, e a diferença entre eles é o que falta provar.
+// Retorna as cores da melhor coloração achada (colors recebe essa coloração). Para grafos
+// pequenos e médios: a busca é exponencial no pior caso e a matriz de bits ocupa n^2/8 bytes.
+int exact_coloring(Graph *graph, int *colors, double time_limit, long long node_limit, ExactColoringReport *report);
+
+// --- Clique Máxima (clique.c) ---
+// Toda clique precisa de cores distintas: o tamanho dela é um limite inferior do número cromático.
+
+typedef enum {
+    CLIQUE_GREEDY,  // A clique gulosa de graph_clique_lower_bound (em cache, O(m · degeneração))
+    CLIQUE_EXACT    // Branch and bound com limite por coloração em matriz de bits (BBMC)
+} CliqueMode;
+
+// Retorna o tamanho da maior clique achada e, se clique != NULL (degeneração + 1 posições basta),
+// os vértices dela. No modo exato, a busca parte da clique gulosa e para em time_limit segundos;
+// *proven (se não for NULL) diz se a clique é provadamente máxima.
+int maximum_clique(Graph *graph, CliqueMode mode, double time_limit, int *clique, bool *proven);
+
+// Desempate do IDO entre vértices com o mesmo número de vizinhos coloridos. Só o modo aproximado
+// é O(n + m); o exato paga o log n do heap para reproduzir a coloração original.
+typedef enum {
+    IDO_TIES_EXACT,  // Maior grau e depois menor índice (heap, O((n + m) log n)); é o padrão
+    IDO_TIES_BUCKET  // Fila de baldes O(n + m), desempate por grau aproximado
+} IdoTieBreak;
+
+int incidence_degree_ordering_coloring_mode(Graph *graph, int *colors, IdoTieBreak ties);
+
+#endif // COLORING_H
@@ -0,0 +1,337 @@
+#include <stdio.h>   // Para perror, fprintf
+#include <stdlib.h>  // Para alocação de memória (malloc, calloc, realloc, free)
+#include <string.h>  // Para memcpy, memset
+#include <pthread.h> // Para a montagem paralela (pthread_create, pthread_join)
+
+#include "graph.h"
+
+// --- Ingestão de Arestas ---
+// Os leitores só acumulam arestas canônicas (u < v) em EdgeBuffers. Depois todas são juntadas,
+// ordenadas por radix sort e deduplicadas em O(m); a lista ordenada e sem repetições é a entrada
+// da montagem do grafo: listas CSR, que saem ordenadas sem nenhum sort por vértice, ou a matriz
+// de bits, conforme a densidade.
+
+// Garante espaço para `needed` arestas no buffer. Retorna false se faltar memória.
+bool edge_buffer_reserve(EdgeBuffer *buffer, size_t needed) {
+    if (needed <= buffer->capacity) {
+        return true;
+    }
+    size_t new_capacity = buffer->capacity > 0 ? buffer->capacity : 1024;
+    while (new_capacity < needed) {
+        new_capacity *= 2;
+    }
+    uint64_t *grown = (uint64_t *)realloc(buffer->edges, new_capacity * sizeof(uint64_t));
+    if (grown == NULL) {
+        perror("Erro ao alocar memória para as arestas");
+        return false;
+    }
+    buffer->edges = grown;
+    buffer->capacity = new_capacity;
+    return true;
+}
+
+// Libera as arestas do buffer e o deixa vazio.
+void edge_buffer_free(EdgeBuffer *buffer) {
+    free(buffer->edges);
+    buffer->edges = NULL;
+    buffer->count = 0;
+    buffer->capacity = 0;
+}
+
+// Ordena `count` chaves por radix sort LSD com dígitos de 8 bits, usando `tmp` (mesmo tamanho)
+// como área auxiliar. Dígitos iguais em todas as chaves (bytes altos de vértices pequenos)
+// não geram passada. Retorna o vetor que contém o resultado (keys ou tmp).
+static uint64_t *radix_sort_keys(uint64_t *keys, uint64_t *tmp, size_t count) {
+    size_t histogram[8][256];
+    memset(histogram, 0, sizeof(histogram));
+    for (size_t i = 0; i < count; i++) {
+        uint64_t key = keys[i];
+        for (int d = 0; d < 8; d++) {
+            histogram[d][(key >> (8 * d)) & 0xFF]++;
+        }
+    }
+
+    uint64_t *src = keys;
+    uint64_t *dst = tmp;
+    for (int d = 0; d < 8; d++) {
+        size_t *bucket = histogram[d];
+        if (bucket[(src[0] >> (8 * d)) & 0xFF] == count) {
+            continue; // Todas as chaves têm o mesmo dígito: a passada não mudaria nada
+        }
+        size_t position = 0;
+        for (int b = 0; b < 256; b++) {
+            size_t size = bucket[b];
+            bucket[b] = position;
+            position += size;
+        }
+        for (size_t i = 0; i < count; i++) {
+            uint64_t key = src[i];
+            dst[bucket[(key >> (8 * d)) & 0xFF]++] = key;
+        }
+        uint64_t *swap = src;
+        src = dst;
+        dst = swap;
+    }
+    return src;
+}
+
+// Junta os buffers (um por thread, em ordem de arquivo) em `out`, ordena as arestas e remove as
+// repetidas (inclusive as lidas invertidas, já que os buffers guardam a forma canônica).
+// Os buffers de entrada são liberados em qualquer caso. Preenche stats com o que foi lido.
+// Retorna false se faltar memória.
+bool edge_list_sort_unique(EdgeBuffer *buffers, int num_buffers, EdgeBuffer *out, EdgeListStats *stats) {
+    size_t total = 0;
+    size_t self_loops = 0;
+    for (int t = 0; t < num_buffers; t++) {
+        total += buffers[t].count;
+        self_loops += buffers[t].self_loops;
+    }
+
+    memset(out, 0, sizeof(*out));
+    if (num_buffers == 1) {
+        *out = buffers[0]; // Um único buffer: usa o próprio vetor, sem cópia
+        memset(&buffers[0], 0, sizeof(buffers[0]));
+    } else {
+        if (!edge_buffer_reserve(out, total)) {
+            // Os buffers são liberados também na falha, como no caminho normal
+            for (int t = 0; t < num_buffers; t++) {
+                edge_buffer_free(&buffers[t]);
+            }
+            return false;
+        }
+        for (int t = 0; t < num_buffers; t++) {
+            memcpy(out->edges + out->count, buffers[t].edges, buffers[t].count * sizeof(uint64_t));
+            out->count += buffers[t].count;
+            edge_buffer_free(&buffers[t]);
+        }
+    }
+    out->self_loops = self_loops;
+
+    // Arquivos gerados costumam listar as arestas já em ordem canônica; nesse caso não há sort
+    bool sorted = true;
+    for (size_t i = 1; i < total && sorted; i++) {
+        sorted = out->edges[i - 1] <= out->edges[i];
+    }
+    if (!sorted) {
+        uint64_t *tmp = (uint64_t *)malloc(total * sizeof(uint64_t));
+        if (tmp == NULL) {
+            perror("Erro ao alocar memória para ordenar as arestas");
+            edge_buffer_free(out);
+            return false;
+        }
+        uint64_t *sorted_keys = radix_sort_keys(out->edges, tmp, total);
+        if (sorted_keys == tmp) {
+            free(out->edges);
+            out->edges = tmp;
+            out->capacity = total;
+        } else {
+            free(tmp);
+        }
+    }
+
+    size_t unique = 0;
+    for (size_t i = 0; i < total; i++) {
+        if (i == 0 || out->edges[i] != out->edges[i - 1]) {
+            out->edges[unique++] = out->edges[i];
+        }
+    }
+    out->count = unique;
+
+    stats->edges_read = total + self_loops;
+    stats->self_loops = self_loops;
+    stats->duplicates = total - unique;
+    return true;
+}
+
+// --- Construção Paralela das Listas CSR ---
+
+// Estado compartilhado pelas fases da construção. A lista ordenada é dividida em trechos
+// contíguos, um por thread. Cada thread t conta os graus do seu trecho em counts[t]; a soma por
+// vértice, em ordem de thread, dá a posição de escrita de cada thread dentro da lista do vértice.
+// Assim não há atômicos e as listas recebem os vizinhos na ordem da lista de arestas. Cada counts[t]
+// ocupa 8 (n + 1) bytes, então o número de threads é limitado a m / n: a memória extra nunca passa
+// das 8 m bytes das próprias listas (sem o limite, 32 threads num grafo esparso de 1M vértices
+// pediriam 256 MB).
+typedef struct {
+    Graph *graph;
+    const uint64_t *edges;
+    int64_t **counts;    // counts[t][v]: arestas de v no trecho t (depois, posição de escrita)
+    int num_threads;
+} CsrBuild;
+
+typedef struct {
+    CsrBuild *build;
+    int thread_id;
+    size_t e_begin, e_end; // Trecho da lista de arestas desta thread
+    int v_begin, v_end;    // Faixa de vértices desta thread
+} CsrTask;
+
+// Executa fn(tasks[t]) para t = 0..num_tasks-1, em paralelo quando há mais de uma tarefa.
+void run_tasks(void *(*fn)(void *), void *tasks, size_t task_size, int num_tasks) {
+    if (num_tasks == 1) {
+        fn(tasks);
+        return;
+    }
+    pthread_t *threads = (pthread_t *)malloc(num_tasks * sizeof(pthread_t));
+    bool *started = (bool *)calloc(num_tasks, sizeof(bool));
+    for (int t = 0; t < num_tasks; t++) {
+        void *task = (char *)tasks + t * task_size;
+        started[t] = threads != NULL && started != NULL && pthread_create(&threads[t], NULL, fn, task) == 0;
+        if (!started[t]) {
+            fn(task); // Sem thread disponível: executa na thread atual
+        }
+    }
+    for (int t = 0; t < num_tasks; t++) {
+        if (started[t]) {
+            pthread_join(threads[t], NULL);
+        }
+    }
+    free(threads);
+    free(started);
+}
+
+static void *csr_count_degrees(void *arg) {
+    CsrTask *task = (CsrTask *)arg;
+    const uint64_t *edges = task->build->edges;
+    int64_t *count = task->build->counts[task->thread_id];
+    for (size_t e = task->e_begin; e < task->e_end; e++) {
+        count[edge_first(edges[e])]++;
+        count[edge_second(edges[e])]++;
+    }
+    return NULL;
+}
+
+static void *csr_sum_degrees(void *arg) {
+    CsrTask *task = (CsrTask *)arg;
+    CsrBuild *build = task->build;
+    for (int v = task->v_begin; v < task->v_end; v++) {
+        int64_t degree = 0;
+        for (int t = 0; t < build->num_threads; t++) {
+            degree += build->counts[t][v];
+        }
+        build->graph->adj_offsets[v + 1] = degree;
+    }
+    return NULL;
+}
+
+static void *csr_write_positions(void *arg) {
+    CsrTask *task = (CsrTask *)arg;
+    CsrBuild *build = task->build;
+    for (int v = task->v_begin; v < task->v_end; v++) {
+        int64_t position = build->graph->adj_offsets[v];
+        for (int t = 0; t < build->num_threads; t++) {
+            int64_t count = build->counts[t][v];
+            build->counts[t][v] = position;
+            position += count;
+        }
+    }
+    return NULL;
+}
+
+// Distribui as arestas do trecho. Como a lista está ordenada por (u, v), a lista de x recebe
+// primeiro os u < x (das arestas (u, x), em ordem de u) e depois os v > x (das arestas (x, v),
+// em ordem de v): cada lista já sai ordenada.
+static void *csr_scatter(void *arg) {
+    CsrTask *task = (CsrTask *)arg;
+    const uint64_t *edges = task->build->edges;
+    int64_t *position = task->build->counts[task->thread_id];
+    int *adj_list = task->build->graph->adj_list;
+    for (size_t e = task->e_begin; e < task->e_end; e++) {
+        int u = edge_first(edges[e]);
+        int v = edge_second(edges[e]);
+        adj_list[position[u]++] = v;
+        adj_list[position[v]++] = u;
+    }
+    return NULL;
+}
+
+// Monta as listas CSR a partir de uma lista de arestas canônicas ordenada e sem repetições
+// (saída de edge_list_sort_unique). Retorna false se faltar memória.
+bool build_csr_from_sorted_edges(Graph *graph, const EdgeBuffer *edges, int num_threads) {
+    int n = graph->num_vertices;
+    if (n > 0 && (size_t)num_threads > edges->count / (size_t)n) num_threads = (int)(edges->count / (size_t)n);
+    if (num_threads < 1) num_threads = 1;
+
+    CsrBuild build = {graph, edges->edges, NULL, num_threads};
+    CsrTask *tasks = (CsrTask *)malloc(num_threads * sizeof(CsrTask));
+    build.counts = (int64_t **)calloc(num_threads, sizeof(int64_t *));
+    bool ok = tasks != NULL && build.counts != NULL;
+    for (int t = 0; ok && t < num_threads; t++) {
+        build.counts[t] = (int64_t *)calloc(n + 1, sizeof(int64_t));
+        ok = build.counts[t] != NULL;
+    }
+    if (!ok) {
+        perror("Erro ao alocar memória para as listas de adjacência");
+    } else if (!graph_alloc_csr(graph, 2 * edges->count)) {
+        ok = false;
+    } else {
+        for (int t = 0; t < num_threads; t++) {
+            tasks[t].build = &build;
+            tasks[t].thread_id = t;
+            tasks[t].e_begin = edges->count * t / num_threads;
+            tasks[t].e_end = edges->count * (t + 1) / num_threads;
+            tasks[t].v_begin = (int)((long long)n * t / num_threads);
+            tasks[t].v_end = (int)((long long)n * (t + 1) / num_threads);
+        }
+
+        // Passo 1: cada thread conta os graus do seu trecho; depois soma-se por vértice
+        run_tasks(csr_count_degrees, tasks, sizeof(CsrTask), num_threads);
+        run_tasks(csr_sum_degrees, tasks, sizeof(CsrTask), num_threads);
+        for (int v = 0; v < n; v++) {
+            graph->adj_offsets[v + 1] += graph->adj_offsets[v];
+        }
+
+        // Passo 2: posição de escrita de cada thread em cada lista, e distribuição das arestas
+        run_tasks(csr_write_positions, tasks, sizeof(CsrTask), num_threads);
+        run_tasks(csr_scatter, tasks, sizeof(CsrTask), num_threads);
+    }
+
+    for (int t = 0; build.counts != NULL && t < num_threads; t++) {
+        free(build.counts[t]);
+    }
+    free(build.counts);
+    free(tasks);
+    return ok;
+}
+
+// Monta a matriz de bits a partir de uma lista de arestas canônicas ordenada e sem repetições.
+// Retorna false se faltar memória.
+bool build_bits_from_sorted_edges(Graph *graph, const EdgeBuffer *edges) {
+    if (!graph_alloc_bits(graph)) {
+        return false;
+    }
+    for (size_t e = 0; e < edges->count; e++) {
+        int u = edge_first(edges->edges[e]);
+        int v = edge_second(edges->edges[e]);
+        adj_bits_row(graph, u)[v >> 6] |= 1ULL << (v & 63);
+        adj_bits_row(graph, v)[u >> 6] |= 1ULL << (u & 63);
+    }
+    return true;
+}
+
+// Monta o grafo a partir dos buffers de arestas (um por thread, liberados aqui), na
+// representação escolhida por graph_choose_layout para o número de arestas distintas.
+// Arestas repetidas (inclusive invertidas) são descartadas; graph->num_arestas passa a ser o
+// número de arestas distintas e stats (se não for NULL) recebe o relatório da leitura.
+// Retorna false se faltar memória.
+bool build_graph_from_edges(Graph *graph, EdgeBuffer *buffers, int num_threads, EdgeListStats *stats) {
+    EdgeBuffer unique;
+    EdgeListStats local_stats;
+    if (!edge_list_sort_unique(buffers, num_threads, &unique, &local_stats)) {
+        return false;
+    }
+    GraphLayout layout = graph_choose_layout(graph->num_vertices, (int64_t)unique.count);
+    bool ok = layout == GRAPH_LAYOUT_BITSET ? build_bits_from_sorted_edges(graph, &unique)
+                                            : build_csr_from_sorted_edges(graph, &unique, num_threads);
+    if (ok) {
+        graph->layout = layout;
+        graph->num_arestas = (int64_t)unique.count;
+        graph->num_self_loops = (long long)local_stats.self_loops;
+        graph->num_duplicates = (long long)local_stats.duplicates;
+        if (stats != NULL) {
+            *stats = local_stats;
+        }
+    }
+    edge_buffer_free(&unique);
+    return ok;
+}
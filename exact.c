@@ -0,0 +1,246 @@
+#include <stdio.h>   // Para perror
+#include <stdlib.h>  // Para alocação de memória (malloc, calloc, free, exit)
+#include <time.h>    // Para o prazo em tempo de parede (clock_gettime, CLOCK_MONOTONIC)
+
+#include "coloring.h"
+
+// --- Coloração Exata (DSATUR com Branch and Bound) ---
+// Busca em profundidade de Brélaz: colore sempre o vértice não colorido de maior saturação
+// (empates pelo maior grau e depois menor índice), tentando cada cor que os vizinhos não usam,
+// das já abertas até uma nova. Uma k-coloração completa vira o novo limite superior, e a busca
+// só continua atrás de colorações com menos cores.
+// - Limite superior inicial: a melhor entre DSATUR e RLF. Inferior: a clique de maximum_clique
+//   (com um décimo do prazo), cujos vértices são pré-coloridos com 1, 2, ... (quebra a simetria
+//   entre as cores).
+// - As cores vizinhas de cada vértice ficam num mapa de bits (cor c = bit c), e as cores
+//   possíveis saem palavra a palavra com ~mapa e __builtin_ctzll.
+// - Os vizinhos não coloridos de v são (linha de v AND não coloridos) na matriz de bits; se o
+//   grafo não está em BITSET, o resolvedor monta as linhas dele.
+// - Corte por verificação adiante: se um vizinho não colorido fica sem nenhuma cor abaixo do
+//   limite superior, o ramo é abandonado.
+
+typedef struct {
+    Graph *graph;
+    int n;
+    const uint64_t *adj;    // Linhas de adjacência em bits
+    size_t adj_stride;      // Palavras entre linhas de adj
+    uint64_t *own_adj;      // Linhas montadas aqui (NULL se adj é a matriz do grafo)
+    int words;              // Palavras por conjunto de vértices
+    uint64_t *uncolored;    // Vértices ainda sem cor
+    const int *degree;
+
+    int color_words;        // Palavras por mapa de cores vizinhas
+    uint64_t *neighbor_colors; // neighbor_colors[v * color_words]: bit c se algum vizinho tem a cor c
+    int *count;             // count[v * (initial_bound + 1) + c]: vizinhos de v com a cor c
+    int count_stride;
+    int *saturation;        // Cores distintas entre os vizinhos
+    int *color;
+
+    int lower_bound;
+    int upper_bound;        // Cores da melhor coloração completa
+    int *best;
+    long long nodes;
+    long long node_limit;
+    double deadline;
+    bool stopped;           // Limite de nós ou de tempo atingido
+} ExactSearch;
+
+static double wall_time(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static inline const uint64_t *exact_adj_row(const ExactSearch *s, int v) {
+    return s->adj + (size_t)v * s->adj_stride;
+}
+
+// Dá a cor c a v e atualiza as cores vizinhas dos vizinhos não coloridos. Retorna false se algum
+// deles ficou sem cor possível abaixo do limite superior (a atribuição é feita mesmo assim, para
+// exact_unassign desfazer sempre a mesma coisa).
+static bool exact_assign(ExactSearch *s, int v, int c) {
+    s->color[v] = c;
+    s->uncolored[v >> 6] &= ~(1ULL << (v & 63));
+    bool feasible = true;
+    const uint64_t *row = exact_adj_row(s, v);
+    for (int w = 0; w < s->words; w++) {
+        uint64_t bits = row[w] & s->uncolored[w];
+        while (bits) {
+            int u = w * 64 + __builtin_ctzll(bits);
+            bits &= bits - 1;
+            if (s->count[(size_t)u * s->count_stride + c]++ == 0) {
+                s->neighbor_colors[(size_t)u * s->color_words + (c >> 6)] |= 1ULL << (c & 63);
+                if (++s->saturation[u] >= s->upper_bound - 1) {
+                    feasible = false;
+                }
+            }
+        }
+    }
+    return feasible;
+}
+
+static void exact_unassign(ExactSearch *s, int v, int c) {
+    const uint64_t *row = exact_adj_row(s, v);
+    for (int w = 0; w < s->words; w++) {
+        uint64_t bits = row[w] & s->uncolored[w];
+        while (bits) {
+            int u = w * 64 + __builtin_ctzll(bits);
+            bits &= bits - 1;
+            if (--s->count[(size_t)u * s->count_stride + c] == 0) {
+                s->neighbor_colors[(size_t)u * s->color_words + (c >> 6)] &= ~(1ULL << (c & 63));
+                s->saturation[u]--;
+            }
+        }
+    }
+    s->uncolored[v >> 6] |= 1ULL << (v & 63);
+    s->color[v] = 0;
+}
+
+// Colore o restante do grafo; used_colors é a maior cor já usada
+static void exact_search(ExactSearch *s, int num_colored, int used_colors) {
+    if (num_colored == s->n) {
+        s->upper_bound = used_colors;
+        for (int v = 0; v < s->n; v++) {
+            s->best[v] = s->color[v];
+        }
+        return;
+    }
+
+    // Vértice de maior saturação entre os não coloridos
+    int v = -1;
+    for (int w = 0; w < s->words; w++) {
+        uint64_t bits = s->uncolored[w];
+        while (bits) {
+            int u = w * 64 + __builtin_ctzll(bits);
+            bits &= bits - 1;
+            if (v < 0 || s->saturation[u] > s->saturation[v] ||
+                (s->saturation[u] == s->saturation[v] && s->degree[u] > s->degree[v])) {
+                v = u;
+            }
+        }
+    }
+
+    // Cores possíveis: 1 .. min(used_colors + 1, upper_bound - 1) fora das cores vizinhas. O
+    // limite superior pode cair durante o laço, então é relido a cada cor.
+    const uint64_t *forbidden = s->neighbor_colors + (size_t)v * s->color_words;
+    for (int w = 0; w < s->color_words; w++) {
+        uint64_t available = ~forbidden[w];
+        if (w == 0) available &= ~1ULL; // Cor 0 não existe
+        while (available) {
+            int c = w * 64 + __builtin_ctzll(available);
+            available &= available - 1;
+            // Um ramo que já usa upper_bound cores (o limite caiu num ramo mais fundo) não melhora
+            int limit = used_colors + 1 < s->upper_bound - 1 ? used_colors + 1 : s->upper_bound - 1;
+            if (c > limit || used_colors >= s->upper_bound || s->stopped || s->upper_bound <= s->lower_bound) return;
+
+            if (++s->nodes >= s->node_limit || ((s->nodes & 1023) == 0 && wall_time() >= s->deadline)) {
+                s->stopped = true;
+                return;
+            }
+            if (exact_assign(s, v, c)) {
+                exact_search(s, num_colored + 1, c > used_colors ? c : used_colors);
+            }
+            exact_unassign(s, v, c);
+        }
+    }
+}
+
+int exact_coloring(Graph *graph, int *colors, double time_limit, long long node_limit, ExactColoringReport *report) {
+    double start_time = wall_time();
+    int n = graph->num_vertices;
+    ExactSearch s = { 0 };
+    s.graph = graph;
+    s.n = n;
+    s.node_limit = node_limit;
+    s.deadline = start_time + time_limit;
+
+    // Limite superior: a melhor heurística construtiva
+    int *rlf_colors = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    if (rlf_colors == NULL) {
+        perror("Erro ao alocar memória para a coloração exata");
+        exit(EXIT_FAILURE);
+    }
+    s.upper_bound = dsatur_coloring(graph, colors);
+    int num_colors_rlf = recursive_largest_first_coloring(graph, rlf_colors);
+    if (num_colors_rlf < s.upper_bound) {
+        s.upper_bound = num_colors_rlf;
+        for (int v = 0; v < n; v++) {
+            colors[v] = rlf_colors[v];
+        }
+    }
+    free(rlf_colors);
+
+    int *clique = (int *)malloc(((size_t)graph_degeneracy(graph) + 1) * sizeof(int));
+    if (clique == NULL) {
+        perror("Erro ao alocar memória para a clique da coloração exata");
+        exit(EXIT_FAILURE);
+    }
+    s.lower_bound = maximum_clique(graph, CLIQUE_EXACT, time_limit / 10, clique, NULL);
+    if (n > 0 && s.upper_bound > s.lower_bound) {
+        s.degree = graph_degrees(graph);
+        s.words = (n + 63) / 64;
+        if (graph->layout == GRAPH_LAYOUT_BITSET) {
+            s.adj = graph->adj_bits;
+            s.adj_stride = graph->bits_stride;
+        } else {
+            s.own_adj = (uint64_t *)calloc((size_t)n * s.words, sizeof(uint64_t));
+            if (s.own_adj == NULL) {
+                perror("Erro ao alocar memória para a matriz de bits da coloração exata");
+                exit(EXIT_FAILURE);
+            }
+            for (int v = 0; v < n; v++) {
+                int u;
+                for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &u);) {
+                    s.own_adj[(size_t)v * s.words + (u >> 6)] |= 1ULL << (u & 63);
+                }
+            }
+            s.adj = s.own_adj;
+            s.adj_stride = s.words;
+        }
+
+        s.color_words = s.upper_bound / 64 + 1;
+        s.count_stride = s.upper_bound + 1;
+        s.uncolored = (uint64_t *)calloc(s.words, sizeof(uint64_t));
+        s.neighbor_colors = (uint64_t *)calloc((size_t)n * s.color_words, sizeof(uint64_t));
+        s.count = (int *)calloc((size_t)n * s.count_stride, sizeof(int));
+        s.saturation = (int *)calloc(n, sizeof(int));
+        s.color = (int *)calloc(n, sizeof(int));
+        s.best = colors;
+        if (s.uncolored == NULL || s.neighbor_colors == NULL || s.count == NULL || s.saturation == NULL ||
+            s.color == NULL) {
+            perror("Erro ao alocar memória para a coloração exata");
+            exit(EXIT_FAILURE);
+        }
+        for (int v = 0; v < n; v++) {
+            s.uncolored[v >> 6] |= 1ULL << (v & 63);
+        }
+
+        // A clique precisa de lower_bound cores distintas em qualquer coloração: fixá-las não
+        // perde soluções e evita repetir a busca para cada permutação das cores
+        bool feasible = true;
+        for (int i = 0; i < s.lower_bound; i++) {
+            feasible = exact_assign(&s, clique[i], i + 1) && feasible;
+        }
+        if (feasible) {
+            exact_search(&s, s.lower_bound, s.lower_bound);
+        }
+
+        free(s.own_adj);
+        free(s.uncolored);
+        free(s.neighbor_colors);
+        free(s.count);
+        free(s.saturation);
+        free(s.color);
+    }
+    free(clique);
+
+    if (report != NULL) {
+        report->upper_bound = s.upper_bound;
+        report->optimal = !s.stopped || s.upper_bound <= s.lower_bound;
+        // Busca completa: nenhuma coloração com menos cores existe, o limite inferior é o próprio
+        report->lower_bound = report->optimal ? s.upper_bound : s.lower_bound;
+        report->nodes = s.nodes;
+        report->seconds = wall_time() - start_time;
+    }
+    return s.upper_bound;
+}
@@ -0,0 +1,289 @@
+#include <stdio.h>   // Para perror
+#include <stdlib.h>  // Para alocação de memória (malloc, free, posix_memalign)
+#include <string.h>  // Para memset
+#include <sys/mman.h> // Para munmap
+
+#include "graph.h"
+
+// --- Funções de Gerenciamento de Memória para o Grafo ---
+
+// Aloca `size` bytes alinhados a 64 bytes (uma linha de cache), arredondando o tamanho
+// para múltiplo de 64. Retorna NULL se faltar memória. Libere com free.
+void *graph_aligned_alloc(size_t size) {
+    void *ptr = NULL;
+    size = (size + 63) & ~(size_t)63;
+    if (size == 0) {
+        size = 64;
+    }
+    if (posix_memalign(&ptr, 64, size) != 0) {
+        return NULL;
+    }
+    return ptr;
+}
+
+// Cria um grafo vazio com n vértices (sem listas). Retorna NULL se faltar memória.
+Graph *graph_create(int num_vertices, int64_t num_arestas) {
+    Graph *graph = (Graph *)malloc(sizeof(Graph));
+    if (graph == NULL) {
+        perror("Erro ao alocar memória para a estrutura Graph");
+        return NULL;
+    }
+    graph->num_vertices = num_vertices;
+    graph->num_arestas = num_arestas;
+    graph->num_self_loops = 0;
+    graph->num_duplicates = 0;
+    graph->layout = GRAPH_LAYOUT_CSR;
+    graph->adj_offsets = NULL; // Inicializa para segurança
+    graph->adj_list = NULL;
+    graph->adj_bits = NULL;
+    graph->words_per_row = 0;
+    graph->bits_stride = 0;
+    graph->byte_offsets = NULL;
+    graph->adj_bytes = NULL;
+    graph->adj_block = NULL;
+    graph->mapping = NULL;
+    graph->mapping_size = 0;
+    graph->analysis = NULL;
+    return graph;
+}
+
+// Aloca adj_offsets (zerado) e adj_list com `entries` posições em um único bloco alinhado:
+// adj_offsets no início e adj_list a partir da linha de cache seguinte. O bloco anterior,
+// se houver, é liberado pelo chamador (o ponteiro antigo continua em uso durante a cópia).
+// Retorna false se faltar memória.
+bool graph_alloc_csr(Graph *graph, size_t entries) {
+    size_t offsets_bytes = ((size_t)(graph->num_vertices + 1) * sizeof(int64_t) + 63) & ~(size_t)63;
+    char *block = (char *)graph_aligned_alloc(offsets_bytes + entries * sizeof(int));
+    if (block == NULL) {
+        perror("Erro ao alocar memória para as listas de adjacência");
+        return false;
+    }
+    memset(block, 0, offsets_bytes);
+    graph->adj_block = block;
+    graph->adj_offsets = (int64_t *)block;
+    graph->adj_list = (int *)(block + offsets_bytes);
+    return true;
+}
+
+// Libera o grafo inteiro (listas CSR ou mapeamento do cache, matriz de bits e a estrutura).
+void free_graph(Graph *graph) {
+    if (graph == NULL) return;
+    if (graph->mapping != NULL) {
+        munmap(graph->mapping, graph->mapping_size); // Listas ou matriz de bits do cache
+    } else {
+        free(graph->adj_block);
+        free(graph->adj_bits);
+    }
+    graph_analysis_free(graph->analysis);
+    free(graph);
+}
+
+// Função de comparação para qsort: ordena inteiros em ordem crescente.
+int compare_int(const void *a, const void *b) {
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+// --- Escolha da Representação ---
+
+// BITSET quando a matriz de bits não ocupa mais memória que as listas CSR, o que acontece a
+// partir de densidade ~1/32 (todas as instâncias densas do benchmark). Na matriz, as perguntas
+// "u e v são vizinhos?" e as operações de conjunto dos algoritmos viram operações palavra a
+// palavra; nas listas, grafos esparsos ocupam O(n + m) em vez de O(n^2).
+GraphLayout graph_choose_layout(int num_vertices, int64_t num_arestas) {
+    size_t bits_bytes = (size_t)num_vertices * ((num_vertices + 63) / 64) * sizeof(uint64_t);
+    size_t csr_bytes = (size_t)num_arestas * 2 * sizeof(int) + (size_t)(num_vertices + 1) * sizeof(int64_t);
+    return bits_bytes <= csr_bytes ? GRAPH_LAYOUT_BITSET : GRAPH_LAYOUT_CSR;
+}
+
+// Nome da representação para relatórios.
+const char *graph_layout_name(GraphLayout layout) {
+    switch (layout) {
+    case GRAPH_LAYOUT_BITSET:
+        return "bitset";
+    case GRAPH_LAYOUT_COMPRESSED:
+        return "varint";
+    default:
+        return "CSR";
+    }
+}
+
+// Aloca a matriz de bits zerada, em uma única alocação alinhada. Cada linha começa em uma
+// linha de cache própria; para C4000.5 são cerca de 2 MB, contra 64 MB da antiga matriz de int.
+// Retorna false se faltar memória.
+bool graph_alloc_bits(Graph *graph) {
+    int n = graph->num_vertices;
+    int words = (n + 63) / 64;
+    int stride = (words + 7) & ~7;
+
+    size_t bytes = ((size_t)n * stride + 1) * sizeof(uint64_t);
+    uint64_t *bits = (uint64_t *)graph_aligned_alloc(bytes);
+    if (bits == NULL) {
+        perror("Erro ao alocar memória para a matriz de bits");
+        return false;
+    }
+    memset(bits, 0, bytes);
+    free(graph->adj_bits);
+    graph->adj_bits = bits;
+    graph->words_per_row = words;
+    graph->bits_stride = stride;
+    return true;
+}
+
+// Libera as adjacências em qualquer representação (blocos alocados ou mapeamento do cache).
+static void release_adjacency(Graph *graph) {
+    if (graph->mapping != NULL) {
+        munmap(graph->mapping, graph->mapping_size); // Listas ou matriz de bits do cache
+    } else {
+        free(graph->adj_block);
+        free(graph->adj_bits);
+    }
+    graph->mapping = NULL;
+    graph->mapping_size = 0;
+    graph->adj_block = NULL;
+    graph->adj_offsets = NULL;
+    graph->adj_list = NULL;
+    graph->adj_bits = NULL;
+    graph->words_per_row = 0;
+    graph->bits_stride = 0;
+    graph->byte_offsets = NULL;
+    graph->adj_bytes = NULL;
+}
+
+// Bytes ocupados por um varint.
+static inline int varint_size(uint32_t value) {
+    int size = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        size++;
+    }
+    return size;
+}
+
+// Grava um varint em out e retorna o número de bytes escritos.
+static inline int varint_encode(uint8_t *out, uint32_t value) {
+    int size = 0;
+    while (value >= 0x80) {
+        out[size++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[size++] = (uint8_t)value;
+    return size;
+}
+
+// Primeiro vizinho como diferença para v, em zigzag (0, -1, 1, -2, ... viram 0, 1, 2, 3, ...).
+static inline uint32_t zigzag(int delta) {
+    return ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31);
+}
+
+// Monta em `target` a representação compactada dos vizinhos de `source` (qualquer representação).
+// Primeiro mede cada linha, depois aloca o bloco exato e codifica. Retorna false se faltar memória.
+static bool build_compressed(Graph *target, const Graph *source) {
+    int n = source->num_vertices;
+    size_t offsets_bytes = ((size_t)(n + 1) * sizeof(int64_t) + 63) & ~(size_t)63;
+    int64_t *sizes = (int64_t *)malloc((size_t)(n + 1) * sizeof(int64_t));
+    if (sizes == NULL) {
+        perror("Erro ao alocar memória para a representação compactada");
+        return false;
+    }
+
+    sizes[0] = 0;
+    for (int v = 0; v < n; v++) {
+        int64_t size = varint_size((uint32_t)graph_degree(source, v));
+        int previous = v;
+        bool first = true;
+        int u;
+        for (NeighborIter it = graph_neighbors(source, v); neighbor_next(&it, &u);) {
+            size += varint_size(first ? zigzag(u - v) : (uint32_t)(u - previous - 1));
+            previous = u;
+            first = false;
+        }
+        sizes[v + 1] = sizes[v] + size;
+    }
+
+    char *block = (char *)graph_aligned_alloc(offsets_bytes + (size_t)sizes[n]);
+    if (block == NULL) {
+        perror("Erro ao alocar memória para a representação compactada");
+        free(sizes);
+        return false;
+    }
+    target->adj_block = block;
+    target->byte_offsets = (int64_t *)block;
+    target->adj_bytes = (uint8_t *)(block + offsets_bytes);
+    memcpy(target->byte_offsets, sizes, (size_t)(n + 1) * sizeof(int64_t));
+    free(sizes);
+
+    for (int v = 0; v < n; v++) {
+        uint8_t *out = target->adj_bytes + target->byte_offsets[v];
+        out += varint_encode(out, (uint32_t)graph_degree(source, v));
+        int previous = v;
+        bool first = true;
+        int u;
+        for (NeighborIter it = graph_neighbors(source, v); neighbor_next(&it, &u);) {
+            out += varint_encode(out, first ? zigzag(u - v) : (uint32_t)(u - previous - 1));
+            previous = u;
+            first = false;
+        }
+    }
+    return true;
+}
+
+// Converte o grafo para a representação pedida, liberando a anterior. A nova é montada a partir
+// do percurso de vizinhos da atual, então qualquer conversão é possível.
+// Retorna false se faltar memória (o grafo continua na representação atual).
+bool graph_set_layout(Graph *graph, GraphLayout layout) {
+    if (graph->layout == layout) {
+        return true;
+    }
+    int n = graph->num_vertices;
+
+    // A nova representação é montada em uma cópia sem adjacências, para a atual continuar legível
+    Graph target = *graph;
+    target.mapping = NULL;
+    target.adj_block = NULL;
+    target.adj_offsets = NULL;
+    target.adj_list = NULL;
+    target.adj_bits = NULL;
+    target.words_per_row = 0;
+    target.bits_stride = 0;
+    target.byte_offsets = NULL;
+    target.adj_bytes = NULL;
+    target.layout = layout;
+
+    bool ok = true;
+    if (layout == GRAPH_LAYOUT_BITSET) {
+        ok = graph_alloc_bits(&target);
+        for (int v = 0; ok && v < n; v++) {
+            uint64_t *row = adj_bits_row(&target, v);
+            int u;
+            for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &u);) {
+                row[u >> 6] |= 1ULL << (u & 63);
+            }
+        }
+    } else if (layout == GRAPH_LAYOUT_CSR) {
+        int64_t entries = 0;
+        for (int v = 0; v < n; v++) {
+            entries += graph_degree(graph, v);
+        }
+        ok = graph_alloc_csr(&target, (size_t)entries);
+        int64_t position = 0;
+        for (int v = 0; ok && v < n; v++) {
+            int u;
+            for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &u);) {
+                target.adj_list[position++] = u;
+            }
+            target.adj_offsets[v + 1] = position;
+        }
+    } else {
+        ok = build_compressed(&target, graph);
+    }
+
+    if (!ok) {
+        release_adjacency(&target);
+        return false;
+    }
+    release_adjacency(graph);
+    *graph = target;
+    return true;
+}
@@ -0,0 +1,372 @@
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include <stdbool.h> // Para usar tipos booleanos (true, false)
+#include <stddef.h>  // Para size_t
+#include <stdint.h>  // Para palavras de 64 bits (uint64_t) da matriz de bits
+
+// --- Estrutura para representar o Grafo ---
+// As adjacências ficam em uma de três representações, indicada em `layout`. A leitura escolhe
+// entre CSR e BITSET pela densidade (graph_choose_layout); a compactada é opcional, pedida com
+// graph_set_layout. Os algoritmos as percorrem pela mesma interface (graph_neighbors/neighbor_next,
+// graph_degree), sem depender de qual está em uso.
+//
+// GRAPH_LAYOUT_CSR (compressed sparse row): os vizinhos do vértice v são
+// adj_list[adj_offsets[v]] .. adj_list[adj_offsets[v + 1] - 1], em ordem crescente.
+// Memória O(n + m). Os deslocamentos são de 64 bits, então o grafo pode ter mais de 2^31
+// entradas; os vértices continuam int. adj_offsets e adj_list ficam em um único bloco
+// alinhado a 64 bytes (adj_block), liberado de uma vez por free_graph.
+//
+// GRAPH_LAYOUT_BITSET: matriz de adjacências em bits, n^2/8 bytes. Cada linha começa em uma
+// nova linha de cache, a bits_stride palavras da anterior, no mesmo bloco. Usada quando ocupa
+// menos que as listas (densidade a partir de ~1/32); adj_offsets e adj_list ficam NULL.
+//
+// GRAPH_LAYOUT_COMPRESSED: somente leitura, para grafos esparsos grandes demais para CSR.
+// A linha de v começa em adj_bytes[byte_offsets[v]] e traz, em varints (7 bits por byte, bit
+// alto = continua): o grau d, o primeiro vizinho como diferença para v (zigzag) e depois as
+// d - 1 diferenças entre vizinhos consecutivos, menos 1. Os dois vetores ficam em adj_block.
+typedef enum {
+    GRAPH_LAYOUT_CSR,
+    GRAPH_LAYOUT_BITSET,
+    GRAPH_LAYOUT_COMPRESSED
+} GraphLayout;
+
+typedef struct {
+    int num_vertices;
+    int64_t num_arestas;      // Arestas distintas (a linha 'p' pode anunciar outro valor)
+    long long num_self_loops; // Laços (u, u) descartados na leitura
+    long long num_duplicates; // Arestas repetidas (ou lidas invertidas) descartadas na leitura
+    GraphLayout layout;   // Representação em uso
+    int64_t *adj_offsets; // n + 1 posições: início da lista de vizinhos de cada vértice (CSR)
+    int *adj_list;      // Listas de vizinhos concatenadas (cada aresta aparece duas vezes)
+    uint64_t *adj_bits; // Matriz de adjacências em bits (BITSET)
+    int words_per_row;  // Palavras de 64 bits com vértices em cada linha de adj_bits
+    int bits_stride;    // Distância, em palavras, entre linhas consecutivas (múltiplo de 8)
+    int64_t *byte_offsets; // n + 1 posições: início da linha de cada vértice em adj_bytes (COMPRESSED)
+    uint8_t *adj_bytes;    // Linhas compactadas concatenadas (COMPRESSED)
+    void *adj_block;    // Bloco alocado com as listas (CSR ou COMPRESSED; NULL se mapeado)
+    void *mapping;      // Cache .bin mapeado com as listas CSR ou a matriz de bits (NULL se foram alocadas)
+    size_t mapping_size;
+    struct GraphAnalysis *analysis; // Graus, ordens, componentes... calculados sob demanda (analysis.c)
+} Graph;
+
+// Arestas lidas por uma thread, na ordem em que aparecem no arquivo. Cada aresta é guardada na
+// forma canônica u < v (0-baseados), empacotada em uma chave (u << 32) | v: ordenar as chaves
+// ordena as arestas por (u, v), e arestas repetidas viram chaves iguais.
+typedef struct {
+    uint64_t *edges;
+    size_t count;
+    size_t capacity;
+    size_t self_loops; // Laços (u, u) descartados por edge_buffer_push
+} EdgeBuffer;
+
+// Relatório da ingestão de arestas.
+typedef struct {
+    size_t edges_read; // Arestas válidas lidas, incluindo laços e repetições
+    size_t self_loops; // Laços descartados
+    size_t duplicates; // Repetições descartadas (inclusive arestas lidas invertidas)
+} EdgeListStats;
+
+// --- Gerenciamento de Memória (graph.c) ---
+
+// Aloca `size` bytes alinhados a 64 bytes. Retorna NULL se faltar memória. Libere com free.
+void *graph_aligned_alloc(size_t size);
+
+// Cria um grafo vazio com n vértices (sem listas). Retorna NULL se faltar memória.
+Graph *graph_create(int num_vertices, int64_t num_arestas);
+
+// Aloca adj_offsets (zerado) e adj_list com `entries` posições em um único bloco alinhado,
+// substituindo as listas atuais. Retorna false se faltar memória.
+bool graph_alloc_csr(Graph *graph, size_t entries);
+
+// Libera o grafo inteiro (listas CSR ou mapeamento do cache, matriz de bits, análise e a estrutura).
+void free_graph(Graph *graph);
+
+// Libera a análise em cache do grafo (analysis.c; os acessores ficam em coloring.h).
+void graph_analysis_free(struct GraphAnalysis *analysis);
+
+// Função de comparação para qsort: ordena inteiros em ordem crescente.
+int compare_int(const void *a, const void *b);
+
+// --- Escolha da Representação (graph.c) ---
+
+// Representação para um grafo com n vértices e m arestas: BITSET quando a matriz de bits não
+// ocupa mais memória que as listas CSR, CSR caso contrário.
+GraphLayout graph_choose_layout(int num_vertices, int64_t num_arestas);
+
+// Nome da representação para relatórios ("CSR", "bitset" ou "varint").
+const char *graph_layout_name(GraphLayout layout);
+
+// Aloca uma matriz de bits zerada para o grafo (adj_bits, words_per_row, bits_stride), sem
+// mudar `layout`. Retorna false se faltar memória.
+bool graph_alloc_bits(Graph *graph);
+
+// Converte o grafo para a representação pedida, liberando a anterior.
+// Retorna false se faltar memória (o grafo continua na representação atual).
+bool graph_set_layout(Graph *graph, GraphLayout layout);
+
+// --- Matriz de Adjacências em Bits ---
+
+// Linha de bits do vértice v (bit j ligado se v e j são adjacentes).
+static inline uint64_t *adj_bits_row(const Graph *graph, int v) {
+    return graph->adj_bits + (size_t)v * graph->bits_stride;
+}
+
+// Número de bits ligados em (a AND b), palavra a palavra.
+static inline int bitset_and_count(const uint64_t *a, const uint64_t *b, int words) {
+    int count = 0;
+    for (int w = 0; w < words; w++) {
+        count += __builtin_popcountll(a[w] & b[w]);
+    }
+    return count;
+}
+
+// Verdadeiro se (a AND b) tiver algum bit ligado.
+static inline bool bitset_intersects(const uint64_t *a, const uint64_t *b, int words) {
+    for (int w = 0; w < words; w++) {
+        if (a[w] & b[w]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// --- Varints da Representação Compactada ---
+
+// Decodifica um varint em *p, avançando o cursor. Valores de um byte (o caso comum nas
+// diferenças entre vizinhos próximos) saem sem laço.
+static inline uint32_t varint_decode(const uint8_t **p) {
+    const uint8_t *q = *p;
+    uint32_t value = *q++;
+    if (value >= 0x80) {
+        value &= 0x7F;
+        int shift = 7;
+        uint32_t byte;
+        do {
+            byte = *q++;
+            value |= (byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte >= 0x80);
+    }
+    *p = q;
+    return value;
+}
+
+// --- Percurso de Vizinhos (qualquer representação) ---
+// Uso:
+//     int u;
+//     for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &u);) { ... }
+// Os vizinhos saem em ordem crescente nas duas representações.
+typedef struct {
+    const int *list, *list_end; // CSR: trecho restante da lista
+    const uint64_t *row;        // BITSET: linha do vértice
+    uint64_t bits;              // BITSET: bits ainda não visitados da palavra atual
+    int word, words;            // BITSET: palavra atual e total de palavras
+    const uint8_t *bytes;       // COMPRESSED: próximo varint da linha
+    int remaining;              // COMPRESSED: vizinhos ainda não decodificados
+    int previous;               // COMPRESSED: último vizinho (v antes do primeiro)
+    bool first;                 // COMPRESSED: o próximo varint é o primeiro vizinho
+    GraphLayout layout;
+} NeighborIter;
+
+static inline NeighborIter graph_neighbors(const Graph *graph, int v) {
+    NeighborIter it;
+    it.layout = graph->layout;
+    it.list = it.list_end = NULL;
+    it.row = NULL;
+    it.bits = 0;
+    it.word = it.words = 0;
+    it.bytes = NULL;
+    it.remaining = 0;
+    it.previous = 0;
+    it.first = false;
+    if (graph->layout == GRAPH_LAYOUT_CSR) {
+        it.list = graph->adj_list + graph->adj_offsets[v];
+        it.list_end = graph->adj_list + graph->adj_offsets[v + 1];
+    } else if (graph->layout == GRAPH_LAYOUT_BITSET) {
+        it.row = adj_bits_row(graph, v);
+        it.words = graph->words_per_row;
+        it.bits = it.words > 0 ? it.row[0] : 0;
+    } else {
+        it.bytes = graph->adj_bytes + graph->byte_offsets[v];
+        it.remaining = (int)varint_decode(&it.bytes);
+        it.previous = v;
+        it.first = true;
+    }
+    return it;
+}
+
+// Próximo vizinho em *u. Retorna false quando não há mais vizinhos.
+static inline bool neighbor_next(NeighborIter *it, int *u) {
+    if (it->layout == GRAPH_LAYOUT_CSR) {
+        if (it->list == it->list_end) {
+            return false;
+        }
+        *u = *it->list++;
+        return true;
+    }
+    if (it->layout == GRAPH_LAYOUT_COMPRESSED) {
+        if (it->remaining == 0) {
+            return false;
+        }
+        uint32_t gap = varint_decode(&it->bytes);
+        if (it->first) {
+            // Diferença para v em zigzag: 0, -1, 1, -2, ... viram 0, 1, 2, 3, ...
+            it->previous += (int)(gap >> 1) ^ -(int)(gap & 1);
+            it->first = false;
+        } else {
+            it->previous += (int)gap + 1;
+        }
+        it->remaining--;
+        *u = it->previous;
+        return true;
+    }
+    while (it->bits == 0) {
+        if (++it->word >= it->words) {
+            return false;
+        }
+        it->bits = it->row[it->word];
+    }
+    *u = it->word * 64 + __builtin_ctzll(it->bits);
+    it->bits &= it->bits - 1;
+    return true;
+}
+
+// Grau do vértice v (tamanho da lista, contagem de bits da linha ou primeiro varint da linha).
+static inline int graph_degree(const Graph *graph, int v) {
+    if (graph->layout == GRAPH_LAYOUT_BITSET) {
+        const uint64_t *row = adj_bits_row(graph, v);
+        int degree = 0;
+        for (int w = 0; w < graph->words_per_row; w++) {
+            degree += __builtin_popcountll(row[w]);
+        }
+        return degree;
+    }
+    if (graph->layout == GRAPH_LAYOUT_COMPRESSED) {
+        const uint8_t *p = graph->adj_bytes + graph->byte_offsets[v];
+        return (int)varint_decode(&p);
+    }
+    return (int)(graph->adj_offsets[v + 1] - graph->adj_offsets[v]);
+}
+
+// u e v são vizinhos? Teste de um bit na matriz, busca binária na lista CSR (ordenada) e
+// decodificação da linha até passar de v na compactada.
+static inline bool graph_has_edge(const Graph *graph, int u, int v) {
+    if (graph->layout == GRAPH_LAYOUT_BITSET) {
+        return adj_bits_row(graph, u)[v >> 6] >> (v & 63) & 1;
+    }
+    if (graph->layout == GRAPH_LAYOUT_COMPRESSED) {
+        int w;
+        for (NeighborIter it = graph_neighbors(graph, u); neighbor_next(&it, &w);) {
+            if (w >= v) return w == v;
+        }
+        return false;
+    }
+    int64_t lo = graph->adj_offsets[u];
+    int64_t hi = graph->adj_offsets[u + 1];
+    while (lo < hi) {
+        int64_t mid = lo + (hi - lo) / 2;
+        if (graph->adj_list[mid] < v) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo < graph->adj_offsets[u + 1] && graph->adj_list[lo] == v;
+}
+
+// --- Ingestão de Arestas e Montagem do Grafo (edge_list.c) ---
+
+// Vértices de uma aresta canônica (primeiro < segundo).
+static inline int edge_first(uint64_t edge) {
+    return (int)(edge >> 32);
+}
+
+static inline int edge_second(uint64_t edge) {
+    return (int)(uint32_t)edge;
+}
+
+// Garante espaço para `needed` arestas no buffer. Retorna false se faltar memória.
+bool edge_buffer_reserve(EdgeBuffer *buffer, size_t needed);
+
+// Libera as arestas do buffer e o deixa vazio.
+void edge_buffer_free(EdgeBuffer *buffer);
+
+// Acrescenta a aresta (u, v) na forma canônica; laços só são contados.
+// Retorna false se faltar memória.
+static inline bool edge_buffer_push(EdgeBuffer *buffer, int u, int v) {
+    if (u == v) {
+        buffer->self_loops++;
+        return true;
+    }
+    if (buffer->count == buffer->capacity && !edge_buffer_reserve(buffer, buffer->count + 1)) {
+        return false;
+    }
+    uint64_t lo = (uint32_t)(u < v ? u : v);
+    uint64_t hi = (uint32_t)(u < v ? v : u);
+    buffer->edges[buffer->count++] = (lo << 32) | hi;
+    return true;
+}
+
+// Junta os buffers (liberando-os) em `out`, ordena as arestas por radix sort e remove as
+// repetidas, em O(m). Retorna false se faltar memória.
+bool edge_list_sort_unique(EdgeBuffer *buffers, int num_buffers, EdgeBuffer *out, EdgeListStats *stats);
+
+// Monta as listas CSR a partir de uma lista de arestas ordenada e sem repetições, com até
+// num_threads threads (no máximo m / n, para a memória extra não passar do tamanho das listas).
+// Retorna false se faltar memória.
+bool build_csr_from_sorted_edges(Graph *graph, const EdgeBuffer *edges, int num_threads);
+
+// Monta a matriz de bits a partir de uma lista de arestas ordenada e sem repetições.
+// Retorna false se faltar memória.
+bool build_bits_from_sorted_edges(Graph *graph, const EdgeBuffer *edges);
+
+// Monta o grafo a partir de buffers de arestas (um por thread, liberados aqui), descartando
+// repetições e atualizando num_arestas/num_self_loops/num_duplicates. A representação é
+// escolhida por graph_choose_layout com o número de arestas distintas.
+// stats pode ser NULL. Retorna false se faltar memória.
+bool build_graph_from_edges(Graph *graph, EdgeBuffer *buffers, int num_threads, EdgeListStats *stats);
+
+// Executa fn(tasks[t]) para t = 0..num_tasks-1, em paralelo quando há mais de uma tarefa.
+void run_tasks(void *(*fn)(void *), void *tasks, size_t task_size, int num_tasks);
+
+// --- Leitura de Grafos e Cache Binário (graph_io.c) ---
+
+// Lê o texto de um arquivo DIMACS com num_threads threads (0 = número de processadores),
+// ignorando qualquer cache. Retorna NULL em caso de erro.
+Graph *read_dimacs_text(const char *filename, int num_threads);
+
+// Lê uma lista de arestas no estilo SNAP ("u v" por linha, vértices 0-baseados, comentários com
+// '#' ou '%'); n é o maior vértice + 1. Retorna NULL em caso de erro.
+Graph *read_edge_list_text(const char *filename, int num_threads);
+
+// Lê um arquivo Matrix Market "coordinate" quadrado como grafo (valores ignorados).
+// Retorna NULL em caso de erro.
+Graph *read_matrix_market_text(const char *filename, int num_threads);
+
+// Lê o texto escolhendo o formato pela extensão: ".mtx" Matrix Market; ".txt", ".edges",
+// ".el" e ".tsv" lista de arestas; qualquer outra DIMACS. Retorna NULL em caso de erro.
+Graph *read_graph_text(const char *filename, int num_threads);
+
+// Lê um grafo DIMACS, usando o cache "<arquivo>.bin" quando ele for mais novo que o texto.
+Graph *read_dimacs_graph_threads(const char *filename, int num_threads);
+
+// Igual a read_dimacs_graph_threads usando todos os processadores.
+Graph *read_dimacs_graph(const char *filename);
+
+// Como read_dimacs_graph_threads/read_dimacs_graph, mas com o formato do texto escolhido
+// por read_graph_text.
+Graph *read_graph_threads(const char *filename, int num_threads);
+Graph *read_graph(const char *filename);
+
+// Nome do arquivo de cache associado a um arquivo DIMACS: "<arquivo>.bin". O chamador libera.
+char *graph_cache_path(const char *filename);
+
+// Grava o grafo no formato binário em `path`. Retorna false em caso de erro.
+bool write_graph_cache(const Graph *graph, const char *path);
+
+// Carrega um grafo do formato binário, mapeando o arquivo somente para leitura.
+// O grafo volta na representação gravada (CSR ou BITSET), apontando para o mapeamento.
+Graph *load_graph_cache(const char *path);
+
+#endif // GRAPH_H
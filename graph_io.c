@@ -0,0 +1,803 @@
+#include <stdio.h>   // Para entrada/saída (fprintf, perror, fopen, fwrite, rename, remove)
+#include <stdlib.h>  // Para alocação de memória (malloc, calloc, realloc, free, qsort)
+#include <string.h>  // Para manipulação de memória (memcpy, memchr, memcmp, memset, strrchr)
+#include <strings.h> // Para strncasecmp
+#include <limits.h>  // Para INT_MAX
+#include <fcntl.h>     // Para open
+#include <unistd.h>    // Para close, sysconf
+#include <sys/mman.h>  // Para mmap, munmap, madvise
+#include <sys/stat.h>  // Para fstat, stat
+
+#include "graph.h"
+
+// --- Leitura de Arquivos Texto (DIMACS, Lista de Arestas, Matrix Market) ---
+
+// O arquivo é mapeado em memória (mmap) e percorrido diretamente por um tokenizador de inteiros,
+// sem fgets/sscanf nem cópias por linha. Aceita linhas de qualquer tamanho e finais "\r\n".
+// A seção de arestas é dividida em trechos terminados em '\n', um por thread, e as arestas vão
+// direto para a ingestão (edge_list.c), sem matriz n x n em nenhum formato.
+
+// Avança sobre espaços e tabulações (não atravessa o fim da linha).
+static inline const char *skip_blanks(const char *p, const char *end) {
+    while (p < end && (*p == ' ' || *p == '\t')) {
+        p++;
+    }
+    return p;
+}
+
+// Avança até o primeiro caractere depois do próximo '\n'.
+static inline const char *skip_line(const char *p, const char *end) {
+    const char *nl = (const char *)memchr(p, '\n', end - p);
+    return nl ? nl + 1 : end;
+}
+
+// Lê um inteiro não negativo em *p, avançando o cursor. Retorna false se não houver dígitos.
+static inline bool parse_uint(const char **p, const char *end, long long *out) {
+    const char *q = skip_blanks(*p, end);
+    if (q == end || *q < '0' || *q > '9') {
+        return false;
+    }
+    long long value = 0;
+    while (q < end && *q >= '0' && *q <= '9') {
+        value = value * 10 + (*q - '0');
+        q++;
+    }
+    *p = q;
+    *out = value;
+    return true;
+}
+
+// Lê uma palavra (sequência sem espaços) em *p, avançando o cursor. Retorna o tamanho (0 se não houver).
+static size_t parse_word(const char **p, const char *end, const char **word) {
+    const char *q = skip_blanks(*p, end);
+    const char *word_end = q;
+    while (word_end < end && *word_end != ' ' && *word_end != '\t' && *word_end != '\r' && *word_end != '\n') {
+        word_end++;
+    }
+    *word = q;
+    *p = word_end;
+    return word_end - q;
+}
+
+// Verdadeiro se a palavra (de tamanho len) for igual a `expected`, ignorando maiúsculas.
+static bool word_equals(const char *word, size_t len, const char *expected) {
+    return len == strlen(expected) && strncasecmp(word, expected, len) == 0;
+}
+
+// Trecho do arquivo processado por uma thread.
+typedef struct {
+    const char *filename;
+    const char *begin, *end;
+    int num_vertices;     // Vértices válidos: [0, num_vertices)
+    int base;             // Índice do primeiro vértice no arquivo (1 em DIMACS e Matrix Market, 0 em SNAP)
+    char comment;         // Caractere que inicia comentários (listas de arestas e Matrix Market)
+    EdgeBuffer buffer;
+    long long max_vertex; // Maior vértice (0-baseado) lido no trecho, -1 se nenhum
+    const char *header;   // Primeira linha 'p' encontrada no trecho (DIMACS; a leitura para nela)
+    bool ok;
+} ParseTask;
+
+// Lê as linhas 'c' e 'e' de um trecho DIMACS, acumulando as arestas válidas no buffer da tarefa.
+// Para na primeira linha 'p', registrando-a em task->header.
+static void *parse_dimacs_lines(void *arg) {
+    ParseTask *task = (ParseTask *)arg;
+    const char *p = task->begin;
+    const char *end = task->end;
+    task->header = NULL;
+    task->ok = true;
+
+    while (p < end) {
+        const char *line = p;
+        char kind = *p;
+
+        if (kind == 'c' || kind == '\n' || kind == '\r') {
+            p = skip_line(p, end); // Linha de comentário ou vazia
+        } else if (kind == 'p') {
+            task->header = line;
+            break;
+        } else if (kind == 'e') {
+            p++;
+            long long u, v; // Vértices da aresta
+            if (!parse_uint(&p, end, &u) || !parse_uint(&p, end, &v)) {
+                fprintf(stderr, "Erro ao parsear linha 'e' em %s\n", task->filename);
+                task->ok = false;
+                break;
+            }
+            u--; // Ajustar para índice 0-baseado
+            v--; // Ajustar para índice 0-baseado
+
+            if (u >= 0 && u < task->num_vertices && v >= 0 && v < task->num_vertices) {
+                // Laços só são contados; repetições são removidas depois, na ingestão
+                if (!edge_buffer_push(&task->buffer, (int)u, (int)v)) {
+                    task->ok = false;
+                    break;
+                }
+            } else {
+                fprintf(stderr, "Aviso: Aresta inválida (%lld, %lld) lida do arquivo %s. Vértices fora do intervalo [1, %d].\n", u + 1, v + 1, task->filename, task->num_vertices);
+            }
+            p = skip_line(p, end);
+        } else {
+            p = skip_line(p, end);
+            fprintf(stderr, "Aviso: Linha de formato desconhecido ignorada: %.*s", (int)(p - line), line);
+        }
+    }
+    return NULL;
+}
+
+// Lê linhas "u v [resto]" de um trecho (lista de arestas SNAP ou entradas Matrix Market),
+// ignorando comentários, linhas vazias e o que vier depois dos dois vértices (pesos, valores).
+static void *parse_pair_lines(void *arg) {
+    ParseTask *task = (ParseTask *)arg;
+    const char *p = task->begin;
+    const char *end = task->end;
+    task->header = NULL;
+    task->ok = true;
+    task->max_vertex = -1;
+
+    while (p < end) {
+        const char *line = p;
+        p = skip_blanks(p, end);
+        if (p == end || *p == task->comment || *p == '\n' || *p == '\r') {
+            p = skip_line(p, end); // Linha de comentário ou vazia
+            continue;
+        }
+        long long u, v; // Vértices da aresta
+        if (!parse_uint(&p, end, &u) || !parse_uint(&p, end, &v)) {
+            p = skip_line(line, end);
+            fprintf(stderr, "Aviso: Linha de formato desconhecido ignorada: %.*s", (int)(p - line), line);
+            continue;
+        }
+        u -= task->base;
+        v -= task->base;
+
+        if (u >= 0 && u < task->num_vertices && v >= 0 && v < task->num_vertices) {
+            if (!edge_buffer_push(&task->buffer, (int)u, (int)v)) {
+                task->ok = false;
+                break;
+            }
+            if (u > task->max_vertex) task->max_vertex = u;
+            if (v > task->max_vertex) task->max_vertex = v;
+        } else {
+            fprintf(stderr, "Aviso: Aresta inválida (%lld, %lld) lida do arquivo %s. Vértices fora do intervalo [%d, %lld].\n",
+                    u + task->base, v + task->base, task->filename, task->base, (long long)task->num_vertices - 1 + task->base);
+        }
+        p = skip_line(p, end);
+    }
+    return NULL;
+}
+
+// Interpreta a linha "p edge n m" (ou "p col n m"). Retorna false se estiver mal formatada.
+static bool parse_dimacs_header(const char *line, const char *end, const char *filename, Graph *graph) {
+    // Tipo do problema: "edge" ou "col"
+    const char *p = line + 1;
+    const char *type;
+    size_t type_len = parse_word(&p, end, &type);
+
+    long long n, m;
+    if (!parse_uint(&p, end, &n) || !parse_uint(&p, end, &m) || n > INT_MAX) {
+        fprintf(stderr, "Erro: Linha 'p' mal formatada em %s: %.*s\n", filename, (int)(skip_line(line, end) - line), line);
+        return false;
+    }
+    if (!((type_len == 4 && memcmp(type, "edge", 4) == 0) || (type_len == 3 && memcmp(type, "col", 3) == 0))) {
+        fprintf(stderr, "Erro: Tipo de problema desconhecido '%.*s' na linha 'p' em %s\n", (int)type_len, type, filename);
+        return false;
+    }
+    graph->num_vertices = (int)n;
+    graph->num_arestas = m;
+    return true;
+}
+
+// Arquivo texto mapeado em memória (data é NULL para arquivos vazios).
+typedef struct {
+    const char *data;
+    const char *end;
+    size_t size;
+} TextFile;
+
+// Mapeia o arquivo somente para leitura. Retorna false (com mensagem) em caso de erro.
+static bool map_text_file(const char *filename, TextFile *file) {
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        perror("Erro ao abrir o arquivo do grafo");
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        perror("Erro ao obter o tamanho do arquivo do grafo");
+        close(fd);
+        return false;
+    }
+    file->size = (size_t)st.st_size;
+    file->data = NULL;
+    if (file->size > 0) {
+        file->data = (const char *)mmap(NULL, file->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (file->data == MAP_FAILED) {
+            perror("Erro ao mapear o arquivo do grafo");
+            close(fd);
+            return false;
+        }
+        madvise((void *)file->data, file->size, MADV_SEQUENTIAL);
+    }
+    close(fd); // O mapeamento continua válido após fechar o descritor
+    file->end = file->data + file->size;
+    return true;
+}
+
+static void unmap_text_file(TextFile *file) {
+    if (file->data) munmap((void *)file->data, file->size);
+}
+
+// Divide [body, end) em trechos terminados em '\n' (ao menos 1 MB por thread), roda `fn` em cada
+// um com os parâmetros de `proto` e monta o grafo com as arestas lidas.
+// Em *max_vertex fica o maior vértice lido (-1 se nenhum). Retorna false em caso de erro.
+static bool parse_text_edges(Graph *graph, const ParseTask *proto, void *(*fn)(void *), const char *body, const char *end,
+                             int num_threads, size_t expected_edges, long long *max_vertex, EdgeListStats *stats) {
+    if (num_threads <= 0) {
+        num_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    size_t max_threads = (size_t)(end - body) / (1 << 20) + 1;
+    if (num_threads < 1) num_threads = 1;
+    if ((size_t)num_threads > max_threads) num_threads = (int)max_threads;
+
+    ParseTask *tasks = (ParseTask *)calloc(num_threads, sizeof(ParseTask));
+    EdgeBuffer *buffers = (EdgeBuffer *)calloc(num_threads, sizeof(EdgeBuffer));
+    bool ok = true;
+    if (tasks == NULL || buffers == NULL) {
+        perror("Erro ao alocar memória para as tarefas de leitura");
+        ok = false;
+    } else {
+        const char *chunk = body;
+        for (int t = 0; t < num_threads; t++) {
+            const char *chunk_end = end;
+            if (t < num_threads - 1) {
+                chunk_end = body + (size_t)(end - body) * (t + 1) / num_threads;
+                chunk_end = chunk_end < chunk ? chunk : skip_line(chunk_end, end);
+            }
+            tasks[t] = *proto;
+            tasks[t].begin = chunk;
+            tasks[t].end = chunk_end;
+            // Pré-aloca a parte de cada thread das arestas anunciadas no cabeçalho
+            if (expected_edges > 0) {
+                edge_buffer_reserve(&tasks[t].buffer, expected_edges / num_threads + 1);
+            }
+            chunk = chunk_end;
+        }
+
+        // Cada thread lê seu trecho para o próprio buffer
+        run_tasks(fn, tasks, sizeof(ParseTask), num_threads);
+        *max_vertex = -1;
+        for (int t = 0; t < num_threads; t++) {
+            if (ok && tasks[t].ok && tasks[t].header != NULL) {
+                fprintf(stderr, "Erro: Linha 'p' repetida em %s\n", proto->filename);
+                ok = false;
+            }
+            ok = ok && tasks[t].ok;
+            if (tasks[t].max_vertex > *max_vertex) *max_vertex = tasks[t].max_vertex;
+            buffers[t] = tasks[t].buffer;
+        }
+
+        // Ordenação e deduplicação das arestas e montagem do grafo
+        if (ok && graph->num_vertices == 0) {
+            graph->num_vertices = (int)(*max_vertex + 1); // Formato sem cabeçalho: n = maior vértice + 1
+        }
+        if (ok) {
+            ok = build_graph_from_edges(graph, buffers, num_threads, stats);
+        }
+        for (int t = 0; t < num_threads; t++) {
+            edge_buffer_free(&buffers[t]);
+        }
+    }
+    free(tasks);
+    free(buffers);
+    return ok;
+}
+
+// Lê o texto de um arquivo DIMACS usando num_threads threads (0 = número de processadores),
+// ignorando qualquer cache .bin. As arestas são acumuladas em buffers por thread e convertidas
+// direto para a representação escolhida pela densidade, sem passar pela matriz de int.
+// Retorna um ponteiro para a estrutura Graph alocada e preenchida, ou NULL em caso de erro.
+Graph *read_dimacs_text(const char *filename, int num_threads) {
+    TextFile file;
+    if (!map_text_file(filename, &file)) {
+        return NULL;
+    }
+    Graph *graph = graph_create(0, 0);
+    if (graph == NULL) {
+        unmap_text_file(&file);
+        return NULL;
+    }
+
+    // Passo 1: lê sequencialmente até a linha 'p' (arestas antes dela são inválidas, como antes)
+    ParseTask prologue = {filename, file.data, file.end, 0, 1, 'c', {NULL, 0, 0, 0}, -1, NULL, true};
+    parse_dimacs_lines(&prologue);
+    edge_buffer_free(&prologue.buffer);
+    bool ok = prologue.ok;
+    if (ok && prologue.header == NULL) {
+        fprintf(stderr, "Erro: Linha 'p' ausente em %s\n", filename);
+        ok = false;
+    }
+    if (ok) {
+        ok = parse_dimacs_header(prologue.header, file.end, filename, graph);
+    }
+
+    // Passo 2: leitura paralela da seção de arestas e montagem do grafo
+    if (ok) {
+        int64_t declared_arestas = graph->num_arestas;
+        ParseTask proto = {filename, NULL, NULL, graph->num_vertices, 1, 'c', {NULL, 0, 0, 0}, -1, NULL, true};
+        long long max_vertex;
+        EdgeListStats stats;
+        ok = parse_text_edges(graph, &proto, parse_dimacs_lines, skip_line(prologue.header, file.end), file.end,
+                              num_threads, (size_t)declared_arestas, &max_vertex, &stats);
+        if (ok && (stats.self_loops > 0 || stats.duplicates > 0 || graph->num_arestas != declared_arestas)) {
+            fprintf(stderr, "Aviso: %s anuncia %lld arestas na linha 'p'; lidas %zu, %zu laços e %zu repetidas ignoradas, %lld distintas.\n",
+                    filename, (long long)declared_arestas, stats.edges_read, stats.self_loops, stats.duplicates, (long long)graph->num_arestas);
+        }
+    }
+
+    unmap_text_file(&file);
+    if (!ok) {
+        free_graph(graph);
+        return NULL;
+    }
+    return graph;
+}
+
+// Lê uma lista de arestas no estilo SNAP: uma aresta "u v" por linha, vértices 0-baseados,
+// comentários iniciados por '#' ou '%' e colunas extras (pesos, tempos) ignoradas. Arestas
+// direcionadas viram não direcionadas; n é o maior vértice + 1.
+// Retorna um ponteiro para a estrutura Graph alocada e preenchida, ou NULL em caso de erro.
+Graph *read_edge_list_text(const char *filename, int num_threads) {
+    TextFile file;
+    if (!map_text_file(filename, &file)) {
+        return NULL;
+    }
+    Graph *graph = graph_create(0, 0);
+    if (graph == NULL) {
+        unmap_text_file(&file);
+        return NULL;
+    }
+
+    // O comentário mais comum é '#'; listas do KONECT e similares usam '%'
+    const char *first = skip_blanks(file.data, file.end);
+    char comment = (first < file.end && *first == '%') ? '%' : '#';
+    ParseTask proto = {filename, NULL, NULL, INT_MAX, 0, comment, {NULL, 0, 0, 0}, -1, NULL, true};
+    long long max_vertex;
+    bool ok = parse_text_edges(graph, &proto, parse_pair_lines, file.data, file.end, num_threads, 0, &max_vertex, NULL);
+
+    unmap_text_file(&file);
+    if (!ok) {
+        free_graph(graph);
+        return NULL;
+    }
+    return graph;
+}
+
+// Lê um arquivo Matrix Market "coordinate" (pattern, real, integer ou complex; general ou
+// simétrico) como grafo: a entrada (i, j) vira a aresta {i, j}, os valores são ignorados e
+// a diagonal conta como laço. A matriz precisa ser quadrada.
+// Retorna um ponteiro para a estrutura Graph alocada e preenchida, ou NULL em caso de erro.
+Graph *read_matrix_market_text(const char *filename, int num_threads) {
+    TextFile file;
+    if (!map_text_file(filename, &file)) {
+        return NULL;
+    }
+    Graph *graph = graph_create(0, 0);
+    if (graph == NULL) {
+        unmap_text_file(&file);
+        return NULL;
+    }
+
+    // Cabeçalho: "%%MatrixMarket matrix coordinate <campo> <simetria>"
+    const char *p = file.data;
+    const char *banner, *object, *format;
+    size_t banner_len = parse_word(&p, file.end, &banner);
+    size_t object_len = parse_word(&p, file.end, &object);
+    size_t format_len = parse_word(&p, file.end, &format);
+    bool ok = true;
+    if (!word_equals(banner, banner_len, "%%MatrixMarket") || !word_equals(object, object_len, "matrix")) {
+        fprintf(stderr, "Erro: Cabeçalho %%%%MatrixMarket ausente em %s\n", filename);
+        ok = false;
+    } else if (!word_equals(format, format_len, "coordinate")) {
+        fprintf(stderr, "Erro: Formato Matrix Market '%.*s' não suportado em %s (só 'coordinate')\n", (int)format_len, format, filename);
+        ok = false;
+    }
+
+    // Comentários até a linha de tamanho "linhas colunas entradas"
+    long long rows = 0, cols = 0, entries = 0;
+    if (ok) {
+        p = skip_line(p, file.end);
+        while (p < file.end && (*p == '%' || *p == '\n' || *p == '\r')) {
+            p = skip_line(p, file.end);
+        }
+        const char *line = p;
+        if (!parse_uint(&p, file.end, &rows) || !parse_uint(&p, file.end, &cols) || !parse_uint(&p, file.end, &entries)) {
+            fprintf(stderr, "Erro: Linha de tamanho mal formatada em %s: %.*s\n", filename, (int)(skip_line(line, file.end) - line), line);
+            ok = false;
+        } else if (rows != cols || rows > INT_MAX) {
+            fprintf(stderr, "Erro: Matriz %lld x %lld em %s não é a adjacência de um grafo (precisa ser quadrada, até %d linhas)\n",
+                    rows, cols, filename, INT_MAX);
+            ok = false;
+        }
+    }
+
+    if (ok) {
+        graph->num_vertices = (int)rows;
+        ParseTask proto = {filename, NULL, NULL, (int)rows, 1, '%', {NULL, 0, 0, 0}, -1, NULL, true};
+        long long max_vertex;
+        ok = parse_text_edges(graph, &proto, parse_pair_lines, skip_line(p, file.end), file.end, num_threads,
+                              (size_t)entries, &max_vertex, NULL);
+    }
+
+    unmap_text_file(&file);
+    if (!ok) {
+        free_graph(graph);
+        return NULL;
+    }
+    return graph;
+}
+
+// Formato do arquivo pela extensão: ".mtx" é Matrix Market; ".txt", ".edges", ".el" e ".tsv"
+// são listas de arestas; o resto (inclusive sem extensão, como as instâncias do benchmark) é DIMACS.
+Graph *read_graph_text(const char *filename, int num_threads) {
+    const char *dot = strrchr(filename, '.');
+    const char *slash = strrchr(filename, '/');
+    if (dot != NULL && (slash == NULL || dot > slash)) {
+        if (strcmp(dot, ".mtx") == 0) {
+            return read_matrix_market_text(filename, num_threads);
+        }
+        if (strcmp(dot, ".txt") == 0 || strcmp(dot, ".edges") == 0 || strcmp(dot, ".el") == 0 || strcmp(dot, ".tsv") == 0) {
+            return read_edge_list_text(filename, num_threads);
+        }
+    }
+    return read_dimacs_text(filename, num_threads);
+}
+
+// --- Cache Binário do Grafo ---
+
+// Formato do arquivo .bin (inteiros na ordem de bytes da máquina que o gerou). O arquivo guarda
+// a representação em que o grafo estava, para a carga não precisar convertê-la:
+//   layout CSR:
+//     GraphCacheHeader
+//     int64 adj_offsets[n + 1]  listas CSR, prontas para uso (alinhadas a 8 bytes)
+//     int32 degrees[n]          graus, conferidos contra as listas na carga
+//     int32 adj_list[entries]
+//   layout BITSET:
+//     GraphCacheHeader, completado com zeros até GRAPH_CACHE_BITS_OFFSET
+//     uint64 adj_bits[entries]  matriz de bits com linhas a bits_stride palavras, como em
+//                               graph_alloc_bits (entries = n * bits_stride + 1)
+// O checksum cobre os vetores. A carga só mapeia o arquivo (mmap somente leitura) e aponta o
+// Graph para dentro dele, sem reconstruir nada: o mapeamento começa em fronteira de página,
+// então as linhas da matriz continuam alinhadas a 64 bytes.
+#define GRAPH_CACHE_MAGIC "DMGRAPH"
+#define GRAPH_CACHE_VERSION 4
+#define GRAPH_CACHE_BITS_OFFSET 128
+
+typedef struct {
+    char magic[8];        // "DMGRAPH\0"
+    uint32_t version;     // GRAPH_CACHE_VERSION
+    uint32_t header_size; // sizeof(GraphCacheHeader), para detectar layouts incompatíveis
+    int64_t num_vertices;
+    int64_t num_arestas;  // Arestas distintas do arquivo original
+    int64_t num_entries;  // Tamanho de adj_list (CSR) ou de adj_bits, em palavras (BITSET)
+    int64_t num_self_loops; // Laços descartados na leitura do texto
+    int64_t num_duplicates; // Repetições descartadas na leitura do texto
+    uint32_t layout;      // GRAPH_LAYOUT_CSR ou GRAPH_LAYOUT_BITSET
+    uint32_t bits_stride; // Palavras entre linhas da matriz (BITSET; 0 em CSR)
+    uint64_t checksum;
+} GraphCacheHeader;
+
+_Static_assert(sizeof(GraphCacheHeader) <= GRAPH_CACHE_BITS_OFFSET, "cabeçalho maior que o espaço reservado");
+
+// Checksum no estilo FNV-1a, processando 8 bytes por passo. Encadeável através de `seed`.
+static uint64_t cache_checksum(uint64_t seed, const void *data, size_t size) {
+    const unsigned char *bytes = (const unsigned char *)data;
+    uint64_t hash = seed;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        memcpy(&word, bytes + i, 8);
+        hash = (hash ^ word) * 1099511628211ULL;
+    }
+    for (; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Checksum de adj_list que também confere se todo vizinho está em 0 .. n - 1: um cache truncado
+// ou editado que colida no checksum viraria leitura fora dos vetores em todos os algoritmos. Os
+// blocos têm tamanho par, então o checksum encadeado é o mesmo de uma passada só, e cada bloco é
+// conferido enquanto ainda está no cache do processador.
+static uint64_t cache_checksum_neighbors(uint64_t seed, const int *list, int64_t entries, int64_t n, bool *in_range) {
+    uint64_t hash = seed;
+    *in_range = true;
+    for (int64_t begin = 0; begin < entries; begin += 4096) {
+        int64_t end = begin + 4096 < entries ? begin + 4096 : entries;
+        hash = cache_checksum(hash, list + begin, (size_t)(end - begin) * sizeof(int));
+        for (int64_t i = begin; i < end; i++) {
+            if (list[i] < 0 || list[i] >= n) *in_range = false;
+        }
+    }
+    return hash;
+}
+
+// Nome do arquivo de cache associado a um arquivo DIMACS: "<arquivo>.bin". O chamador libera.
+char *graph_cache_path(const char *filename) {
+    size_t len = strlen(filename);
+    char *path = (char *)malloc(len + 5);
+    if (path != NULL) {
+        memcpy(path, filename, len);
+        memcpy(path + len, ".bin", 5);
+    }
+    return path;
+}
+
+// Grava o grafo no formato binário em `path` (via arquivo temporário + rename). Um grafo em
+// BITSET é gravado como matriz de bits; CSR e a representação compactada, como listas CSR.
+// Retorna false em caso de erro.
+bool write_graph_cache(const Graph *graph, const char *path) {
+    int n = graph->num_vertices;
+    bool bitset = graph->layout == GRAPH_LAYOUT_BITSET;
+
+    // A representação compactada é convertida em listas CSR temporárias
+    const int64_t *offsets = graph->adj_offsets;
+    const int *list = graph->adj_list;
+    int64_t *tmp_offsets = NULL;
+    int *tmp_list = NULL;
+    int *degrees = NULL;
+    size_t tmp_len = strlen(path) + 5;
+    char *tmp_path = (char *)malloc(tmp_len);
+    bool alloc_ok = tmp_path != NULL;
+    if (alloc_ok && !bitset) {
+        degrees = (int *)malloc((n + 1) * sizeof(int));
+        alloc_ok = degrees != NULL;
+    }
+    if (alloc_ok && graph->layout == GRAPH_LAYOUT_COMPRESSED) {
+        tmp_offsets = (int64_t *)malloc((n + 1) * sizeof(int64_t));
+        tmp_list = (int *)malloc(((size_t)graph->num_arestas * 2 + 1) * sizeof(int));
+        alloc_ok = tmp_offsets != NULL && tmp_list != NULL;
+        if (alloc_ok) {
+            tmp_offsets[0] = 0;
+            for (int v = 0; v < n; v++) {
+                int64_t position = tmp_offsets[v];
+                int u;
+                for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &u);) {
+                    tmp_list[position++] = u;
+                }
+                tmp_offsets[v + 1] = position;
+            }
+            offsets = tmp_offsets;
+            list = tmp_list;
+        }
+    }
+    if (!alloc_ok) {
+        perror("Erro ao alocar memória para gravar o cache");
+        free(degrees);
+        free(tmp_path);
+        free(tmp_offsets);
+        free(tmp_list);
+        return false;
+    }
+    snprintf(tmp_path, tmp_len, "%s.tmp", path);
+
+    GraphCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, GRAPH_CACHE_MAGIC, sizeof(header.magic));
+    header.version = GRAPH_CACHE_VERSION;
+    header.header_size = sizeof(GraphCacheHeader);
+    header.num_vertices = n;
+    header.num_arestas = graph->num_arestas;
+    header.num_self_loops = graph->num_self_loops;
+    header.num_duplicates = graph->num_duplicates;
+    int64_t entries;
+    if (bitset) {
+        entries = (int64_t)n * graph->bits_stride + 1;
+        header.layout = GRAPH_LAYOUT_BITSET;
+        header.bits_stride = (uint32_t)graph->bits_stride;
+        header.checksum = cache_checksum(14695981039346656037ULL, graph->adj_bits, entries * sizeof(uint64_t));
+    } else {
+        entries = offsets[n];
+        for (int v = 0; v < n; v++) {
+            degrees[v] = (int)(offsets[v + 1] - offsets[v]);
+        }
+        header.layout = GRAPH_LAYOUT_CSR;
+        header.checksum = cache_checksum(14695981039346656037ULL, offsets, (n + 1) * sizeof(int64_t));
+        header.checksum = cache_checksum(header.checksum, degrees, n * sizeof(int));
+        header.checksum = cache_checksum(header.checksum, list, entries * sizeof(int));
+    }
+    header.num_entries = entries;
+
+    bool ok = false;
+    FILE *f = fopen(tmp_path, "wb");
+    if (f == NULL) {
+        perror("Erro ao criar o arquivo de cache");
+    } else {
+        ok = fwrite(&header, sizeof(header), 1, f) == 1;
+        if (bitset) {
+            static const char padding[GRAPH_CACHE_BITS_OFFSET] = { 0 };
+            size_t pad = GRAPH_CACHE_BITS_OFFSET - sizeof(header);
+            ok = ok && (pad == 0 || fwrite(padding, 1, pad, f) == pad) &&
+                 fwrite(graph->adj_bits, sizeof(uint64_t), entries, f) == (size_t)entries;
+        } else {
+            ok = ok && fwrite(offsets, sizeof(int64_t), n + 1, f) == (size_t)n + 1 &&
+                 fwrite(degrees, sizeof(int), n, f) == (size_t)n &&
+                 fwrite(list, sizeof(int), entries, f) == (size_t)entries;
+        }
+        ok = (fclose(f) == 0) && ok;
+        if (ok && rename(tmp_path, path) != 0) {
+            ok = false;
+        }
+        if (!ok) {
+            perror("Erro ao gravar o arquivo de cache");
+            remove(tmp_path);
+        }
+    }
+
+    free(degrees);
+    free(tmp_path);
+    free(tmp_offsets);
+    free(tmp_list);
+    return ok;
+}
+
+// Confere e liga as listas CSR de um cache mapeado ao grafo. Retorna false se estiverem inconsistentes.
+static bool attach_cached_csr(Graph *graph, void *data, int64_t n, int64_t entries, uint64_t expected) {
+    int64_t *offsets = (int64_t *)((char *)data + sizeof(GraphCacheHeader));
+    const int *degrees = (const int *)(offsets + n + 1);
+    int *list = (int *)(degrees + n);
+    uint64_t checksum = cache_checksum(14695981039346656037ULL, offsets, (n + 1) * sizeof(int64_t));
+    checksum = cache_checksum(checksum, degrees, n * sizeof(int));
+    bool in_range;
+    checksum = cache_checksum_neighbors(checksum, list, entries, n, &in_range);
+    bool ok = checksum == expected && in_range && offsets[0] == 0 && offsets[n] == entries;
+    for (int64_t v = 0; ok && v < n; v++) {
+        ok = degrees[v] == offsets[v + 1] - offsets[v] && degrees[v] >= 0;
+    }
+    if (ok) {
+        graph->layout = GRAPH_LAYOUT_CSR;
+        graph->adj_offsets = offsets;
+        graph->adj_list = list;
+    }
+    return ok;
+}
+
+// Confere e liga a matriz de bits de um cache mapeado ao grafo. Retorna false se estiver inconsistente.
+static bool attach_cached_bits(Graph *graph, void *data, int64_t entries, int stride, uint64_t expected) {
+    uint64_t *bits = (uint64_t *)((char *)data + GRAPH_CACHE_BITS_OFFSET);
+    if (cache_checksum(14695981039346656037ULL, bits, entries * sizeof(uint64_t)) != expected) {
+        return false;
+    }
+    // Bits além da coluna n - 1 virariam vizinhos inexistentes na iteração das linhas
+    int n = graph->num_vertices;
+    int words = (n + 63) / 64;
+    uint64_t tail = n % 64 != 0 ? ~0ULL << (n % 64) : 0;
+    for (int v = 0; v < n; v++) {
+        if (bits[(size_t)v * stride + words - 1] & tail) {
+            return false;
+        }
+    }
+    graph->layout = GRAPH_LAYOUT_BITSET;
+    graph->adj_bits = bits;
+    graph->words_per_row = (graph->num_vertices + 63) / 64;
+    graph->bits_stride = stride;
+    return true;
+}
+
+// Carrega um grafo do formato binário, mapeando o arquivo somente para leitura.
+// As adjacências do Graph (listas CSR ou matriz de bits) apontam para o mapeamento, que é
+// desfeito por free_graph.
+// Retorna NULL (com aviso) se o arquivo for inválido, de outra versão ou estiver corrompido.
+Graph *load_graph_cache(const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        perror("Erro ao abrir o arquivo de cache");
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(GraphCacheHeader)) {
+        fprintf(stderr, "Aviso: Cache %s inválido (arquivo truncado).\n", path);
+        close(fd);
+        return NULL;
+    }
+    size_t size = (size_t)st.st_size;
+    void *data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        perror("Erro ao mapear o arquivo de cache");
+        return NULL;
+    }
+    madvise(data, size, MADV_WILLNEED);
+
+    const GraphCacheHeader *header = (const GraphCacheHeader *)data;
+    int64_t n = header->num_vertices;
+    int64_t entries = header->num_entries;
+    int stride = (int)(((n + 63) / 64 + 7) & ~7); // Mesmo espaçamento de graph_alloc_bits
+    bool ok = memcmp(header->magic, GRAPH_CACHE_MAGIC, sizeof(header->magic)) == 0 &&
+              header->version == GRAPH_CACHE_VERSION &&
+              header->header_size == sizeof(GraphCacheHeader) &&
+              n >= 0 && n < INT_MAX && entries >= 0;
+    if (ok && header->layout == GRAPH_LAYOUT_BITSET) {
+        ok = header->bits_stride == (uint32_t)stride && entries == n * stride + 1 &&
+             size == GRAPH_CACHE_BITS_OFFSET + (size_t)entries * sizeof(uint64_t);
+    } else if (ok) {
+        ok = header->layout == GRAPH_LAYOUT_CSR &&
+             size == sizeof(GraphCacheHeader) + (size_t)(n + 1) * sizeof(int64_t) + (size_t)(n + entries) * sizeof(int);
+    }
+    if (!ok) {
+        fprintf(stderr, "Aviso: Cache %s inválido ou de versão incompatível.\n", path);
+        munmap(data, size);
+        return NULL;
+    }
+
+    Graph *graph = graph_create((int)n, header->num_arestas);
+    if (graph == NULL) {
+        munmap(data, size);
+        return NULL;
+    }
+    ok = header->layout == GRAPH_LAYOUT_BITSET ? attach_cached_bits(graph, data, entries, stride, header->checksum)
+                                               : attach_cached_csr(graph, data, n, entries, header->checksum);
+    if (!ok) {
+        fprintf(stderr, "Aviso: Cache %s corrompido (checksum ou listas inconsistentes).\n", path);
+        munmap(data, size);
+        free_graph(graph);
+        return NULL;
+    }
+    graph->num_self_loops = header->num_self_loops;
+    graph->num_duplicates = header->num_duplicates;
+    graph->mapping = data;
+    graph->mapping_size = size;
+    return graph;
+}
+
+// Mapeia o cache "<arquivo>.bin" se ele existir e for mais novo que o texto (com a mesma data, o
+// texto pode ter sido reescrito depois do cache dentro da resolução do sistema de arquivos, e o
+// texto é relido). O cache já
+// guarda a representação escolhida pela densidade na gravação; a conversão só acontece se ele
+// foi gravado de um grafo em outra representação.
+// Retorna NULL se não houver cache utilizável (um cache inválido gera um aviso).
+static Graph *load_fresh_graph_cache(const char *filename) {
+    char *cache_path = graph_cache_path(filename);
+    Graph *graph = NULL;
+    struct stat text_st, cache_st;
+    if (cache_path != NULL && stat(cache_path, &cache_st) == 0) {
+        bool text_exists = stat(filename, &text_st) == 0;
+        bool cache_is_fresh = !text_exists ||
+                              cache_st.st_mtim.tv_sec > text_st.st_mtim.tv_sec ||
+                              (cache_st.st_mtim.tv_sec == text_st.st_mtim.tv_sec && cache_st.st_mtim.tv_nsec > text_st.st_mtim.tv_nsec);
+        if (cache_is_fresh) {
+            graph = load_graph_cache(cache_path);
+        }
+        if (graph != NULL) {
+            graph_set_layout(graph, graph_choose_layout(graph->num_vertices, graph->num_arestas));
+        }
+    }
+    free(cache_path);
+    return graph;
+}
+
+// Lê um grafo DIMACS usando num_threads threads para o texto (0 = número de processadores).
+// Se existir o cache "<arquivo>.bin" mais novo que o texto, ele é mapeado no lugar do
+// texto; um cache inválido gera um aviso e a leitura volta para o texto.
+// Retorna um ponteiro para a estrutura Graph alocada e preenchida, ou NULL em caso de erro.
+Graph *read_dimacs_graph_threads(const char *filename, int num_threads) {
+    Graph *graph = load_fresh_graph_cache(filename);
+    return graph != NULL ? graph : read_dimacs_text(filename, num_threads);
+}
+
+// Lê um arquivo DIMACS de grafo e preenche uma estrutura Graph, usando todos os processadores.
+// Retorna um ponteiro para a estrutura Graph alocada e preenchida, ou NULL em caso de erro.
+Graph *read_dimacs_graph(const char *filename) {
+    return read_dimacs_graph_threads(filename, 0);
+}
+
+// Igual a read_dimacs_graph_threads, mas escolhendo o formato do texto pela extensão
+// (DIMACS, lista de arestas SNAP ou Matrix Market; ver read_graph_text).
+Graph *read_graph_threads(const char *filename, int num_threads) {
+    Graph *graph = load_fresh_graph_cache(filename);
+    return graph != NULL ? graph : read_graph_text(filename, num_threads);
+}
+
+// Lê um grafo em qualquer formato suportado, usando todos os processadores.
+Graph *read_graph(const char *filename) {
+    return read_graph_threads(filename, 0);
+}
@@ -0,0 +1,716 @@
+#include <stdio.h>   // Para perror
+#include <stdlib.h>  // Para alocação de memória (malloc, calloc, free, exit)
+#include <limits.h>  // Para LLONG_MAX e INT_MAX
+#include <pthread.h> // Para as threads do algoritmo evolutivo (pthread_create, pthread_mutex_lock)
+#include <time.h>    // Para o prazo em tempo de parede (clock_gettime, CLOCK_MONOTONIC)
+#include <unistd.h>  // Para sysconf
+
+#include "coloring.h"
+
+// --- Melhoria de Colorações ---
+// Algoritmos que partem de uma coloração válida (de qualquer heurística da biblioteca) e tentam
+// reduzir o número de cores até esgotar um prazo em segundos de tempo de parede. A sequência
+// aleatória depende só de `seed`; quantas iterações cabem no prazo depende da máquina.
+
+static double wall_time(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Gerador splitmix64: rápido, estado de 64 bits, sem dependências
+static inline uint64_t random_next(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Inteiro uniforme em [0, bound) (o viés do módulo é desprezível para bound pequeno)
+static inline int random_below(uint64_t *state, int bound) {
+    return (int)(random_next(state) % (uint64_t)bound);
+}
+
+// Maior cor usada em colors
+static int coloring_num_colors(const int *colors, int n) {
+    int num_colors = 0;
+    for (int v = 0; v < n; v++) {
+        if (colors[v] > num_colors) {
+            num_colors = colors[v];
+        }
+    }
+    return num_colors;
+}
+
+// --- Iterated Greedy (Culberson) ---
+
+// Se os vértices de cada classe de cor aparecem juntos na ordem, o First Fit nessa ordem nunca
+// usa mais cores que a coloração de partida: cada vértice pode, no pior caso, ficar com a cor da
+// sua classe. Cada iteração reordena as classes e recolore em O(n + m); as classes de tamanho
+// decrescente, a ordem inversa e a aleatória são escolhidas na proporção 5:5:3 de Culberson.
+typedef enum {
+    CLASSES_REVERSE,
+    CLASSES_LARGEST_FIRST,
+    CLASSES_RANDOM
+} ClassOrder;
+
+int iterated_greedy_coloring(Graph *graph, int *colors, double time_limit, uint64_t seed) {
+    int n = graph->num_vertices;
+    if (n == 0) {
+        return 0;
+    }
+    int num_colors = coloring_num_colors(colors, n);
+    // A clique é um limite inferior: chegando nele, não há o que melhorar
+    int lower_bound = graph_clique_lower_bound(graph, NULL);
+
+    int *order = (int *)malloc(n * sizeof(int));
+    int *classes = (int *)malloc(((size_t)n + 1) * sizeof(int)); // Cores na ordem escolhida
+    int *size = (int *)malloc(((size_t)n + 2) * sizeof(int));    // Vértices de cada cor
+    int *start = (int *)malloc(((size_t)n + 2) * sizeof(int));   // Início de cada cor em order
+    FirstFitScratch scratch;
+    if (order == NULL || classes == NULL || size == NULL || start == NULL ||
+        !first_fit_init(&scratch, graph_max_degree(graph))) {
+        perror("Erro ao alocar memória para o Iterated Greedy");
+        exit(EXIT_FAILURE);
+    }
+
+    uint64_t rng = seed;
+    double deadline = wall_time() + time_limit;
+    while (num_colors > lower_bound && wall_time() < deadline) {
+        for (int c = 0; c <= num_colors; c++) {
+            size[c] = 0;
+        }
+        for (int v = 0; v < n; v++) {
+            size[colors[v]]++;
+        }
+
+        int pick = random_below(&rng, 13);
+        ClassOrder kind = pick < 5 ? CLASSES_REVERSE : pick < 10 ? CLASSES_LARGEST_FIRST : CLASSES_RANDOM;
+        if (kind == CLASSES_LARGEST_FIRST) {
+            // Counting sort das cores por tamanho decrescente (start serve de contador)
+            for (int s = 0; s <= n + 1; s++) {
+                start[s] = 0;
+            }
+            for (int c = 1; c <= num_colors; c++) {
+                start[size[c]]++;
+            }
+            int position = 0;
+            for (int s = n; s >= 0; s--) {
+                int count = start[s];
+                start[s] = position;
+                position += count;
+            }
+            for (int c = 1; c <= num_colors; c++) {
+                classes[start[size[c]]++] = c;
+            }
+        } else {
+            for (int i = 0; i < num_colors; i++) {
+                classes[i] = num_colors - i;
+            }
+            if (kind == CLASSES_RANDOM) {
+                for (int i = num_colors - 1; i > 0; i--) {
+                    int j = random_below(&rng, i + 1);
+                    int swap = classes[i];
+                    classes[i] = classes[j];
+                    classes[j] = swap;
+                }
+            }
+        }
+
+        // Vértices agrupados por classe, na ordem das classes
+        int position = 0;
+        for (int i = 0; i < num_colors; i++) {
+            start[classes[i]] = position;
+            position += size[classes[i]];
+        }
+        for (int v = 0; v < n; v++) {
+            order[start[colors[v]]++] = v;
+        }
+
+        for (int v = 0; v < n; v++) {
+            colors[v] = 0;
+        }
+        num_colors = 0;
+        for (int i = 0; i < n; i++) {
+            int v = order[i];
+            colors[v] = first_fit_pick(&scratch, graph, colors, v);
+            if (colors[v] > num_colors) {
+                num_colors = colors[v];
+            }
+        }
+    }
+
+    free(order);
+    free(classes);
+    free(size);
+    free(start);
+    first_fit_free(&scratch);
+
+    return num_colors;
+}
+
+// --- TabuCol (Hertz-de Werra, com a lista tabu de Galinier-Hao) ---
+
+// Busca uma k-coloração minimizando o número de arestas em conflito (pontas com a mesma cor).
+// gamma[v][c] conta os vizinhos de v com a cor c, então mover v de a para c muda os conflitos
+// em gamma[v][c] - gamma[v][a], e cada movimento atualiza só as linhas dos vizinhos de v,
+// O(grau(v)). As linhas de gamma e da lista tabu começam em 64 bytes (uma linha de cache) e são
+// contíguas, então avaliar as cores de um vértice é uma varredura linear. As cores aqui são
+// 0 .. k - 1.
+typedef struct {
+    Graph *graph;
+    int k;
+    int stride;           // Colunas por linha de gamma/tabu (k inicial arredondado para 16)
+    int *color;
+    int *gamma;           // gamma[v * stride + c]
+    long long *tabu;      // tabu[v * stride + c]: iteração até a qual v não pode voltar à cor c
+    int *conflicted;      // Vértices com algum vizinho da mesma cor
+    int *conflict_pos;    // Posição em conflicted (-1: fora)
+    int num_conflicted;
+    int conflicts;        // Arestas em conflito
+    long long iteration;  // Iterações feitas (nunca volta, então a lista tabu não precisa ser limpa)
+} TabuCol;
+
+static void tabucol_set_conflicted(TabuCol *t, int v) {
+    bool in_conflict = t->gamma[(size_t)v * t->stride + t->color[v]] > 0;
+    if (in_conflict && t->conflict_pos[v] < 0) {
+        t->conflict_pos[v] = t->num_conflicted;
+        t->conflicted[t->num_conflicted++] = v;
+    } else if (!in_conflict && t->conflict_pos[v] >= 0) {
+        int last = t->conflicted[--t->num_conflicted];
+        t->conflicted[t->conflict_pos[v]] = last;
+        t->conflict_pos[last] = t->conflict_pos[v];
+        t->conflict_pos[v] = -1;
+    }
+}
+
+static void tabucol_move(TabuCol *t, int v, int c) {
+    int a = t->color[v];
+    int *row = t->gamma + (size_t)v * t->stride;
+    t->conflicts += row[c] - row[a];
+    t->color[v] = c;
+    int u;
+    for (NeighborIter it = graph_neighbors(t->graph, v); neighbor_next(&it, &u);) {
+        int *neighbor_row = t->gamma + (size_t)u * t->stride;
+        neighbor_row[a]--;
+        neighbor_row[c]++;
+        if (t->color[u] == a || t->color[u] == c) {
+            tabucol_set_conflicted(t, u);
+        }
+    }
+    tabucol_set_conflicted(t, v);
+}
+
+// Aloca as tabelas para colorações de até max_k cores. Retorna false se faltar memória.
+static bool tabucol_init(TabuCol *t, Graph *graph, int max_k) {
+    int n = graph->num_vertices;
+    t->graph = graph;
+    t->k = max_k;
+    t->stride = (max_k + 15) / 16 * 16;
+    t->iteration = 0;
+    size_t cells = (size_t)n * t->stride;
+    t->color = (int *)malloc(n * sizeof(int));
+    t->gamma = (int *)graph_aligned_alloc(cells * sizeof(int));
+    t->tabu = (long long *)graph_aligned_alloc(cells * sizeof(long long));
+    t->conflicted = (int *)malloc(n * sizeof(int));
+    t->conflict_pos = (int *)malloc(n * sizeof(int));
+    if (t->color == NULL || t->gamma == NULL || t->tabu == NULL || t->conflicted == NULL || t->conflict_pos == NULL) {
+        return false;
+    }
+    for (size_t i = 0; i < cells; i++) {
+        t->tabu[i] = 0;
+    }
+    return true;
+}
+
+static void tabucol_free(TabuCol *t) {
+    free(t->color);
+    free(t->gamma);
+    free(t->tabu);
+    free(t->conflicted);
+    free(t->conflict_pos);
+}
+
+// Monta gamma e a lista de conflitos para a coloração em t->color (cores 0 .. k - 1), O(n k + m).
+// Depois disso, só tabucol_move as atualiza.
+static void tabucol_load(TabuCol *t, int k) {
+    int n = t->graph->num_vertices;
+    t->k = k;
+    for (size_t i = 0; i < (size_t)n * t->stride; i++) {
+        t->gamma[i] = 0;
+    }
+    for (int v = 0; v < n; v++) {
+        int u;
+        for (NeighborIter it = graph_neighbors(t->graph, v); neighbor_next(&it, &u);) {
+            t->gamma[(size_t)v * t->stride + t->color[u]]++;
+        }
+    }
+    t->num_conflicted = 0;
+    t->conflicts = 0;
+    for (int v = 0; v < n; v++) {
+        t->conflict_pos[v] = -1;
+        tabucol_set_conflicted(t, v);
+        t->conflicts += t->gamma[(size_t)v * t->stride + t->color[v]];
+    }
+    t->conflicts /= 2; // Cada aresta em conflito foi contada pelas duas pontas
+}
+
+// Tira a maior cor: cada vértice dela vai para a cor (das k - 1 restantes) com menos conflitos
+static void tabucol_drop_color(TabuCol *t) {
+    int k = t->k - 1;
+    for (int v = 0; v < t->graph->num_vertices; v++) {
+        if (t->color[v] != k) continue;
+        const int *row = t->gamma + (size_t)v * t->stride;
+        int best = 0;
+        for (int c = 1; c < k; c++) {
+            if (row[c] < row[best]) best = c;
+        }
+        tabucol_move(t, v, best);
+    }
+    t->k = k;
+}
+
+// Busca tabu com k fixo por até max_iterations iterações, parando antes se os conflitos
+// chegarem a zero (retorna true) ou se o prazo passar (*out_of_time = true).
+static bool tabucol_search(TabuCol *t, long long max_iterations, double deadline, uint64_t *rng, bool *out_of_time) {
+    int k = t->k;
+    int best_conflicts = t->conflicts;
+    for (long long step = 0; t->conflicts > 0 && step < max_iterations; step++) {
+        if ((t->iteration & 1023) == 0 && wall_time() >= deadline) {
+            *out_of_time = true;
+            break;
+        }
+        // Melhor movimento (v, c) entre os vértices em conflito: não tabu, ou tabu mas levando
+        // a menos conflitos que o melhor já visto nesta busca (aspiração). Empates sorteados.
+        int best_delta = t->graph->num_vertices;
+        int ties = 0;
+        int move_v = -1, move_c = -1;
+        for (int i = 0; i < t->num_conflicted; i++) {
+            int v = t->conflicted[i];
+            int a = t->color[v];
+            const int *row = t->gamma + (size_t)v * t->stride;
+            const long long *tabu_row = t->tabu + (size_t)v * t->stride;
+            for (int c = 0; c < k; c++) {
+                int delta = row[c] - row[a];
+                if (delta > best_delta || c == a) continue;
+                if (tabu_row[c] > t->iteration && t->conflicts + delta >= best_conflicts) continue;
+                if (delta < best_delta) {
+                    best_delta = delta;
+                    ties = 1;
+                    move_v = v;
+                    move_c = c;
+                } else if (random_below(rng, ++ties) == 0) {
+                    move_v = v;
+                    move_c = c;
+                }
+            }
+        }
+        if (move_v < 0) {
+            // Todos os movimentos são tabu: um aleatório
+            move_v = t->conflicted[random_below(rng, t->num_conflicted)];
+            move_c = (t->color[move_v] + 1 + random_below(rng, k - 1)) % k;
+        }
+
+        int tenure = (int)(0.6 * t->num_conflicted) + random_below(rng, 10);
+        t->tabu[(size_t)move_v * t->stride + t->color[move_v]] = t->iteration + tenure;
+        tabucol_move(t, move_v, move_c);
+        if (t->conflicts < best_conflicts) {
+            best_conflicts = t->conflicts;
+        }
+        t->iteration++;
+    }
+    return t->conflicts == 0;
+}
+
+int tabucol_coloring(Graph *graph, int *colors, double time_limit, uint64_t seed, double *time_to_k) {
+    int n = graph->num_vertices;
+    if (n == 0) {
+        return 0;
+    }
+    double start_time = wall_time();
+    double deadline = start_time + time_limit;
+    int num_colors = coloring_num_colors(colors, n);
+    int lower_bound = graph_clique_lower_bound(graph, NULL);
+    if (time_to_k != NULL) {
+        for (int k = 0; k <= num_colors; k++) {
+            time_to_k[k] = -1.0;
+        }
+        time_to_k[num_colors] = 0.0;
+    }
+
+    TabuCol t;
+    if (!tabucol_init(&t, graph, num_colors)) {
+        perror("Erro ao alocar memória para o TabuCol");
+        exit(EXIT_FAILURE);
+    }
+    // A coloração recebida não tem conflitos: gamma é montada uma vez e depois só atualizada
+    for (int v = 0; v < n; v++) {
+        t.color[v] = colors[v] - 1;
+    }
+    tabucol_load(&t, num_colors);
+
+    uint64_t rng = seed;
+    bool out_of_time = false;
+    while (t.k > lower_bound && !out_of_time) {
+        tabucol_drop_color(&t);
+        if (tabucol_search(&t, LLONG_MAX, deadline, &rng, &out_of_time)) {
+            for (int v = 0; v < n; v++) {
+                colors[v] = t.color[v] + 1;
+            }
+            num_colors = t.k;
+            if (time_to_k != NULL) {
+                time_to_k[t.k] = wall_time() - start_time;
+            }
+        }
+    }
+
+    tabucol_free(&t);
+    return num_colors;
+}
+
+// --- Algoritmo Evolutivo Híbrido (HEA, Galinier-Hao) ---
+
+// População de k-colorações (com conflitos) que evolui por cruzamento GPX seguido de busca tabu
+// no filho, que substitui o pior dos pais. Achada uma k-coloração sem conflitos, k diminui.
+// A população é dividida entre as threads: cada uma tem sua fatia, sua TabuCol e seus vetores,
+// e não aloca nada depois de começar. Os melhores indivíduos migram em anel (thread t para
+// t + 1) por uma caixa de correio de uma posição, sem trava: o remetente só escreve com a caixa
+// vazia e a marca cheia (release); o destinatário copia e a marca vazia. Só a melhor coloração
+// global, atualizada quando k diminui (raro), fica sob mutex.
+
+#define HEA_SLICE 5             // Indivíduos por thread
+#define HEA_TABU_ITERATIONS 10  // Iterações de busca tabu por filho, vezes n
+
+enum { MAILBOX_EMPTY, MAILBOX_FULL };
+
+typedef struct {
+    int state;    // Atômico: MAILBOX_EMPTY ou MAILBOX_FULL
+    int k;        // Cores do indivíduo na caixa
+    int *color;   // n posições, alocadas antes das threads
+} HeaMailbox;
+
+typedef struct {
+    Graph *graph;
+    double start_time;
+    double deadline;
+    int lower_bound;
+    int initial_colors;
+    const int *initial;     // Coloração recebida, cores 0 .. initial_colors - 1
+    int best_k;             // Atômico: cores da melhor coloração sem conflitos
+    int *best;              // Melhor coloração (cores 0 .. best_k - 1), sob best_lock
+    double *time_to_k;
+    pthread_mutex_t best_lock;
+    HeaMailbox *mailbox;    // mailbox[t]: saída da thread t, lida pela thread t + 1
+    int num_threads;
+} Hea;
+
+typedef struct {
+    Hea *shared;
+    int thread_id;
+    uint64_t seed;
+} HeaTask;
+
+// Cruzamento GPX: o filho recebe, alternando entre os pais, a maior classe de cor ainda não
+// atribuída; o que sobra no fim ganha cor aleatória. members/start listam os vértices de cada
+// classe dos pais (counting sort), e count[p][c] é quantos deles ainda não têm cor no filho.
+typedef struct {
+    int *members[2];
+    int *start[2];
+    int *count[2];
+    bool *assigned;
+} Gpx;
+
+static void gpx_crossover(Gpx *x, const int *parent_a, const int *parent_b, int *child, int n, int k, uint64_t *rng) {
+    const int *parents[2] = { parent_a, parent_b };
+    for (int p = 0; p < 2; p++) {
+        int *start = x->start[p];
+        for (int c = 0; c <= k; c++) {
+            start[c] = 0;
+        }
+        for (int v = 0; v < n; v++) {
+            start[parents[p][v] + 1]++;
+        }
+        for (int c = 0; c < k; c++) {
+            x->count[p][c] = start[c + 1];
+            start[c + 1] += start[c];
+        }
+        for (int v = 0; v < n; v++) {
+            x->members[p][start[parents[p][v]]++] = v;
+        }
+        for (int c = k; c > 0; c--) {
+            start[c] = start[c - 1];
+        }
+        start[0] = 0;
+    }
+    for (int v = 0; v < n; v++) {
+        x->assigned[v] = false;
+    }
+
+    for (int color = 0; color < k; color++) {
+        int p = color & 1;
+        int largest = 0;
+        for (int c = 1; c < k; c++) {
+            if (x->count[p][c] > x->count[p][largest]) largest = c;
+        }
+        for (int i = x->start[p][largest]; i < x->start[p][largest + 1]; i++) {
+            int v = x->members[p][i];
+            if (x->assigned[v]) continue;
+            x->assigned[v] = true;
+            child[v] = color;
+            x->count[0][parent_a[v]]--;
+            x->count[1][parent_b[v]]--;
+        }
+    }
+    for (int v = 0; v < n; v++) {
+        if (!x->assigned[v]) {
+            child[v] = random_below(rng, k);
+        }
+    }
+}
+
+// Registra uma coloração sem conflitos com k cores, se for melhor que a global
+static void hea_publish_best(Hea *hea, const int *color, int k) {
+    pthread_mutex_lock(&hea->best_lock);
+    if (k < hea->best_k) {
+        for (int v = 0; v < hea->graph->num_vertices; v++) {
+            hea->best[v] = color[v];
+        }
+        if (hea->time_to_k != NULL) {
+            hea->time_to_k[k] = wall_time() - hea->start_time;
+        }
+        __atomic_store_n(&hea->best_k, k, __ATOMIC_RELEASE);
+    }
+    pthread_mutex_unlock(&hea->best_lock);
+}
+
+static void *hea_worker(void *arg) {
+    HeaTask *task = (HeaTask *)arg;
+    Hea *hea = task->shared;
+    Graph *graph = hea->graph;
+    int n = graph->num_vertices;
+    uint64_t rng = task->seed;
+    long long tabu_iterations = (long long)HEA_TABU_ITERATIONS * n;
+
+    // Tudo o que a thread usa é alocado aqui, uma vez
+    TabuCol t;
+    Gpx x;
+    FirstFitScratch scratch;
+    int *population = (int *)malloc((size_t)HEA_SLICE * n * sizeof(int));
+    int score[HEA_SLICE];
+    int *child = (int *)malloc(n * sizeof(int));
+    for (int p = 0; p < 2; p++) {
+        x.members[p] = (int *)malloc(n * sizeof(int));
+        x.start[p] = (int *)malloc(((size_t)hea->initial_colors + 1) * sizeof(int));
+        x.count[p] = (int *)malloc(((size_t)hea->initial_colors + 1) * sizeof(int));
+    }
+    x.assigned = (bool *)malloc(n * sizeof(bool));
+    if (!tabucol_init(&t, graph, hea->initial_colors) || !first_fit_init(&scratch, graph_max_degree(graph)) ||
+        population == NULL || child == NULL ||
+        x.members[0] == NULL || x.members[1] == NULL || x.start[0] == NULL || x.start[1] == NULL ||
+        x.count[0] == NULL || x.count[1] == NULL || x.assigned == NULL) {
+        perror("Erro ao alocar memória para o algoritmo evolutivo");
+        exit(EXIT_FAILURE);
+    }
+    HeaMailbox *outbox = &hea->mailbox[task->thread_id];
+    HeaMailbox *inbox = &hea->mailbox[(task->thread_id + hea->num_threads - 1) % hea->num_threads];
+
+    // Fatia inicial: a coloração recebida (na thread 0) e colorações First Fit em ordem aleatória,
+    // todas com as cores acima de k sorteadas em 0 .. k - 1 e melhoradas pela busca tabu
+    int k = __atomic_load_n(&hea->best_k, __ATOMIC_ACQUIRE) - 1;
+    bool out_of_time = false;
+    for (int i = 0; i < HEA_SLICE && !out_of_time; i++) {
+        int *individual = population + (size_t)i * n;
+        if (i == 0 && task->thread_id == 0) {
+            for (int v = 0; v < n; v++) {
+                individual[v] = hea->initial[v];
+            }
+        } else {
+            // child serve de ordem aleatória para o First Fit (cores 1, 2, ...; 0 = sem cor)
+            for (int v = 0; v < n; v++) {
+                int j = random_below(&rng, v + 1);
+                child[v] = child[j];
+                child[j] = v;
+                individual[v] = 0;
+            }
+            for (int j = 0; j < n; j++) {
+                individual[child[j]] = first_fit_pick(&scratch, graph, individual, child[j]);
+            }
+            for (int v = 0; v < n; v++) {
+                individual[v]--;
+            }
+        }
+        for (int v = 0; v < n; v++) {
+            t.color[v] = individual[v] >= k ? random_below(&rng, k) : individual[v];
+        }
+        tabucol_load(&t, k);
+        tabucol_search(&t, tabu_iterations, hea->deadline, &rng, &out_of_time);
+        for (int v = 0; v < n; v++) {
+            individual[v] = t.color[v];
+        }
+        score[i] = t.conflicts;
+        if (t.conflicts == 0) {
+            hea_publish_best(hea, individual, k);
+        }
+    }
+    int sent_score = INT_MAX; // Conflitos do último indivíduo enviado nesta k
+
+    while (!out_of_time && wall_time() < hea->deadline) {
+        // Alguma thread achou uma k-coloração: todos passam a buscar k - 1 cores
+        int best_k = __atomic_load_n(&hea->best_k, __ATOMIC_ACQUIRE);
+        if (best_k <= hea->lower_bound) break;
+        if (k >= best_k) {
+            k = best_k - 1;
+            for (int i = 0; i < HEA_SLICE; i++) {
+                int *individual = population + (size_t)i * n;
+                for (int v = 0; v < n; v++) {
+                    if (individual[v] >= k) individual[v] = random_below(&rng, k);
+                }
+                score[i] = INT_MAX; // Desconhecido até o próximo carregamento
+            }
+            sent_score = INT_MAX;
+        }
+
+        // Migração: o indivíduo recebido substitui o pior da fatia
+        int worst = 0;
+        for (int i = 1; i < HEA_SLICE; i++) {
+            if (score[i] > score[worst]) worst = i;
+        }
+        if (hea->num_threads > 1 && __atomic_load_n(&inbox->state, __ATOMIC_ACQUIRE) == MAILBOX_FULL) {
+            if (inbox->k == k) {
+                int *individual = population + (size_t)worst * n;
+                for (int v = 0; v < n; v++) {
+                    individual[v] = inbox->color[v];
+                }
+                score[worst] = INT_MAX;
+            }
+            __atomic_store_n(&inbox->state, MAILBOX_EMPTY, __ATOMIC_RELEASE);
+        }
+
+        // Geração: dois pais distintos, GPX, busca tabu, o filho substitui o pior pai
+        int a = random_below(&rng, HEA_SLICE);
+        int b = (a + 1 + random_below(&rng, HEA_SLICE - 1)) % HEA_SLICE;
+        gpx_crossover(&x, population + (size_t)a * n, population + (size_t)b * n, t.color, n, k, &rng);
+        tabucol_load(&t, k);
+        tabucol_search(&t, tabu_iterations, hea->deadline, &rng, &out_of_time);
+        if (t.conflicts == 0) {
+            hea_publish_best(hea, t.color, k);
+        }
+        int replaced = score[a] >= score[b] ? a : b;
+        int *individual = population + (size_t)replaced * n;
+        for (int v = 0; v < n; v++) {
+            individual[v] = t.color[v];
+        }
+        score[replaced] = t.conflicts;
+
+        // Um filho melhor que o último enviado vai para a próxima thread, se a caixa estiver livre
+        if (hea->num_threads > 1 && t.conflicts < sent_score &&
+            __atomic_load_n(&outbox->state, __ATOMIC_ACQUIRE) == MAILBOX_EMPTY) {
+            for (int v = 0; v < n; v++) {
+                outbox->color[v] = t.color[v];
+            }
+            outbox->k = k;
+            __atomic_store_n(&outbox->state, MAILBOX_FULL, __ATOMIC_RELEASE);
+            sent_score = t.conflicts;
+        }
+    }
+
+    tabucol_free(&t);
+    first_fit_free(&scratch);
+    free(population);
+    free(child);
+    for (int p = 0; p < 2; p++) {
+        free(x.members[p]);
+        free(x.start[p]);
+        free(x.count[p]);
+    }
+    free(x.assigned);
+    return NULL;
+}
+
+int hybrid_evolutionary_coloring(Graph *graph, int *colors, double time_limit, int num_threads, uint64_t seed,
+                                 double *time_to_k) {
+    int n = graph->num_vertices;
+    if (n == 0) {
+        return 0;
+    }
+    Hea hea = { 0 };
+    hea.graph = graph;
+    hea.start_time = wall_time();
+    hea.deadline = hea.start_time + time_limit;
+    hea.initial_colors = coloring_num_colors(colors, n);
+    hea.lower_bound = graph_clique_lower_bound(graph, NULL); // Análise antes das threads
+    graph_max_degree(graph);
+    hea.best_k = hea.initial_colors;
+    hea.time_to_k = time_to_k;
+    if (time_to_k != NULL) {
+        for (int k = 0; k <= hea.initial_colors; k++) {
+            time_to_k[k] = -1.0;
+        }
+        time_to_k[hea.initial_colors] = 0.0;
+    }
+    if (hea.initial_colors <= hea.lower_bound) {
+        return hea.initial_colors;
+    }
+
+    if (num_threads <= 0) {
+        num_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (num_threads < 1) num_threads = 1;
+    int *initial = (int *)malloc(n * sizeof(int));
+    hea.best = (int *)malloc(n * sizeof(int));
+    hea.mailbox = (HeaMailbox *)calloc(num_threads, sizeof(HeaMailbox));
+    HeaTask *tasks = (HeaTask *)calloc(num_threads, sizeof(HeaTask));
+    pthread_t *threads = (pthread_t *)malloc(num_threads * sizeof(pthread_t));
+    if (initial == NULL || hea.best == NULL || hea.mailbox == NULL || tasks == NULL || threads == NULL) {
+        perror("Erro ao alocar memória para o algoritmo evolutivo");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < n; v++) {
+        initial[v] = colors[v] - 1;
+        hea.best[v] = initial[v];
+    }
+    hea.initial = initial;
+    for (int t = 0; t < num_threads; t++) {
+        hea.mailbox[t].color = (int *)malloc(n * sizeof(int));
+        if (hea.mailbox[t].color == NULL) {
+            perror("Erro ao alocar memória para a migração do algoritmo evolutivo");
+            exit(EXIT_FAILURE);
+        }
+    }
+    pthread_mutex_init(&hea.best_lock, NULL);
+
+    // A thread 0 roda na atual. Se pthread_create falhar, as que existem trabalham sozinhas: a
+    // caixa da última criada fica sem leitor e a da thread 0 sem remetente, só a migração se perde.
+    uint64_t rng = seed;
+    int started = 1;
+    for (int t = 0; t < num_threads; t++) {
+        tasks[t].shared = &hea;
+        tasks[t].thread_id = t;
+        tasks[t].seed = random_next(&rng);
+    }
+    hea.num_threads = num_threads;
+    while (started < num_threads && pthread_create(&threads[started], NULL, hea_worker, &tasks[started]) == 0) {
+        started++;
+    }
+    hea_worker(&tasks[0]);
+    for (int t = 1; t < started; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    int num_colors = hea.best_k;
+    for (int v = 0; v < n; v++) {
+        colors[v] = hea.best[v] + 1;
+    }
+
+    pthread_mutex_destroy(&hea.best_lock);
+    for (int t = 0; t < num_threads; t++) {
+        free(hea.mailbox[t].color);
+    }
+    free(hea.mailbox);
+    free(hea.best);
+    free(initial);
+    free(tasks);
+    free(threads);
+
+    return num_colors;
+}
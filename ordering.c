@@ -0,0 +1,117 @@
+#include <stdio.h>   // Para perror
+#include <stdlib.h>  // Para alocação de memória (malloc, calloc, free, exit)
+#include <string.h>  // Para memcpy
+
+#include "coloring.h"
+
+// --- Ordens de Vértices ---
+// Ordens reutilizáveis para o núcleo First Fit (greedy_coloring_in_order). Ambas são lineares:
+// counting sort pelo grau em vez de qsort, e fila de baldes para a ordem smallest-last. Os graus
+// vêm da análise em cache (graph_degrees).
+
+void degree_ordering(Graph *graph, int *order) {
+    int n = graph->num_vertices;
+    const int *degree = graph_degrees(graph);
+    int max_degree = graph_max_degree(graph);
+    // start[d]: primeira posição dos vértices de grau d, com os graus maiores primeiro
+    int *start = (int *)calloc((size_t)max_degree + 2, sizeof(int));
+    if (start == NULL) {
+        perror("Erro ao alocar memória para a ordem por grau");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int v = 0; v < n; v++) {
+        start[degree[v]]++;
+    }
+    int position = 0;
+    for (int d = max_degree; d >= 0; d--) {
+        int count = start[d];
+        start[d] = position;
+        position += count;
+    }
+    // Percorrer v em ordem crescente deixa o counting sort estável: empates por menor índice
+    for (int v = 0; v < n; v++) {
+        order[start[degree[v]]++] = v;
+    }
+
+    free(start);
+}
+
+int smallest_last_ordering(Graph *graph, int *order) {
+    int n = graph->num_vertices;
+    int max_degree = graph_max_degree(graph);
+    // Algoritmo de Batagelj-Zaversnik: `vert` guarda os vértices ordenados pelo grau restante,
+    // bin[d] é o início do balde de grau d em `vert` e pos[v] a posição de v. Remover o vértice
+    // de menor grau e decrementar um vizinho são trocas dentro de `vert`, O(1) cada.
+    int *degree = (int *)malloc((n > 0 ? n : 1) * sizeof(int)); // Grau no grafo restante
+    int *bin = (int *)calloc((size_t)max_degree + 2, sizeof(int));
+    int *vert = (int *)malloc(n * sizeof(int));
+    int *pos = (int *)malloc(n * sizeof(int));
+    if (degree == NULL || bin == NULL || vert == NULL || pos == NULL) {
+        perror("Erro ao alocar memória para a ordem smallest-last");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(degree, graph_degrees(graph), n * sizeof(int));
+
+    for (int v = 0; v < n; v++) {
+        bin[degree[v]]++;
+    }
+    int position = 0;
+    for (int d = 0; d <= max_degree; d++) {
+        int count = bin[d];
+        bin[d] = position;
+        position += count;
+    }
+    for (int v = 0; v < n; v++) {
+        pos[v] = bin[degree[v]]++;
+        vert[pos[v]] = v;
+    }
+    for (int d = max_degree; d > 0; d--) {
+        bin[d] = bin[d - 1];
+    }
+    bin[0] = 0;
+
+    int degeneracy = 0;
+    for (int i = 0; i < n; i++) {
+        // vert[i] tem o menor grau entre os vértices restantes
+        int v = vert[i];
+        if (degree[v] > degeneracy) {
+            degeneracy = degree[v];
+        }
+        // Ordem smallest-last: o último removido é colorido primeiro
+        order[n - 1 - i] = v;
+
+        int u;
+        for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &u);) {
+            if (degree[u] > degree[v]) {
+                // Troca u com o primeiro vértice do seu balde e encolhe o balde
+                int du = degree[u];
+                int first = bin[du];
+                int w = vert[first];
+                if (w != u) {
+                    vert[pos[u]] = w;
+                    pos[w] = pos[u];
+                    vert[first] = u;
+                    pos[u] = first;
+                }
+                bin[du]++;
+                degree[u]--;
+            }
+        }
+    }
+
+    free(degree);
+    free(bin);
+    free(vert);
+    free(pos);
+
+    return degeneracy;
+}
+
+// --- Algoritmo Smallest Last (SL) para Coloração de Vértices ---
+
+// First Fit na ordem smallest-last: cada vértice tem no máximo degeneracy vizinhos coloridos
+// antes dele, então usa no máximo degeneracy + 1 cores.
+int smallest_last_coloring(Graph *graph, int *colors) {
+    return greedy_coloring_in_order(graph, graph_smallest_last_order(graph), colors);
+}
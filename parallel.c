@@ -0,0 +1,464 @@
+#include <stdio.h>   // Para perror
+#include <stdlib.h>  // Para alocação de memória (malloc, calloc, free, exit)
+#include <pthread.h> // Para as threads e barreiras (pthread_create, pthread_barrier_wait)
+#include <unistd.h>  // Para sysconf
+
+#include "coloring.h"
+
+// --- Coloração Paralela ---
+// Os algoritmos paralelos usam threads persistentes (ParallelTeam) que se sincronizam por
+// barreira a cada rodada. Dentro de uma rodada, o trabalho é dividido por escalonamento dinâmico
+// em blocos: cada thread pega o próximo bloco de PARALLEL_CHUNK vértices de um índice
+// compartilhado (incremento atômico), então quem termina cedo pega mais blocos da fila comum. Não
+// é roubo de trabalho: não há filas por thread, e todas disputam o mesmo índice, o que basta
+// enquanto um bloco custa bem mais que o incremento atômico.
+
+#define PARALLEL_CHUNK 256
+
+// Threads a usar: num_threads <= 0 pede uma por CPU; grafos pequenos não compensam as threads.
+static int parallel_thread_count(int num_threads, int num_vertices) {
+    if (num_threads <= 0) {
+        num_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    int useful = num_vertices / PARALLEL_CHUNK;
+    if (num_threads > useful) num_threads = useful;
+    if (num_threads < 1) num_threads = 1;
+    return num_threads;
+}
+
+// Grupo de threads de um algoritmo. As threads são criadas antes de começar e só passam do
+// portão quando todas existem: se pthread_create falhar, a barreira é montada com as que foram
+// criadas, e o trabalho, dividido dinamicamente, fica com elas.
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t opened;
+    bool open;
+    pthread_barrier_t barrier;
+    int size;  // Threads participantes (incluindo a que chamou parallel_team_run)
+} ParallelTeam;
+
+// Primeira coisa que cada tarefa faz: espera o portão abrir.
+static void parallel_team_enter(ParallelTeam *team) {
+    pthread_mutex_lock(&team->lock);
+    while (!team->open) {
+        pthread_cond_wait(&team->opened, &team->lock);
+    }
+    pthread_mutex_unlock(&team->lock);
+}
+
+// Executa fn(tasks[t]) com até num_tasks threads; a tarefa 0 roda na thread atual. Retorna
+// quantas tarefas rodaram (as primeiras team->size).
+static int parallel_team_run(ParallelTeam *team, void *(*fn)(void *), void *tasks, size_t task_size, int num_tasks) {
+    pthread_mutex_init(&team->lock, NULL);
+    pthread_cond_init(&team->opened, NULL);
+    team->open = false;
+
+    pthread_t *threads = (pthread_t *)malloc(num_tasks * sizeof(pthread_t));
+    int started = 1;
+    while (threads != NULL && started < num_tasks &&
+           pthread_create(&threads[started], NULL, fn, (char *)tasks + started * task_size) == 0) {
+        started++;
+    }
+    team->size = started;
+    pthread_barrier_init(&team->barrier, NULL, started);
+
+    pthread_mutex_lock(&team->lock);
+    team->open = true;
+    pthread_cond_broadcast(&team->opened);
+    pthread_mutex_unlock(&team->lock);
+
+    fn(tasks);
+    for (int t = 1; t < started; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    free(threads);
+    pthread_barrier_destroy(&team->barrier);
+    pthread_cond_destroy(&team->opened);
+    pthread_mutex_destroy(&team->lock);
+    return started;
+}
+
+// Prioridade pseudoaleatória de v (splitmix64 de seed e v): depende só da semente e do vértice,
+// não da ordem em que as threads rodam.
+static inline uint64_t vertex_priority(uint64_t seed, int v) {
+    uint64_t z = seed + 0x9E3779B97F4A7C15ULL * ((uint64_t)v + 1);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Vértice e prioridade, para ordenar com qsort
+typedef struct {
+    uint64_t priority;
+    int v;
+} PrioritizedVertex;
+
+// Prioridade decrescente, empates pelo menor índice (a mesma ordem de jp_before)
+static int compare_prioritized(const void *a, const void *b) {
+    const PrioritizedVertex *x = (const PrioritizedVertex *)a;
+    const PrioritizedVertex *y = (const PrioritizedVertex *)b;
+    if (x->priority != y->priority) return x->priority < y->priority ? 1 : -1;
+    return (x->v > y->v) - (x->v < y->v);
+}
+
+void jones_plassmann_order(Graph *graph, uint64_t seed, int *order) {
+    int n = graph->num_vertices;
+    PrioritizedVertex *vertices = (PrioritizedVertex *)malloc((n > 0 ? n : 1) * sizeof(PrioritizedVertex));
+    if (vertices == NULL) {
+        perror("Erro ao alocar memória para a ordem do Jones-Plassmann");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < n; v++) {
+        vertices[v].priority = vertex_priority(seed, v);
+        vertices[v].v = v;
+    }
+    qsort(vertices, n, sizeof(PrioritizedVertex), compare_prioritized);
+    for (int i = 0; i < n; i++) {
+        order[i] = vertices[i].v;
+    }
+    free(vertices);
+}
+
+// --- Algoritmo Jones-Plassmann para Coloração de Vértices ---
+
+// Cada vértice espera pelos vizinhos de prioridade maior: waiting[v] conta os que ainda não
+// foram coloridos. A cada rodada, a fronteira (waiting == 0) é colorida em paralelo com First
+// Fit, e cada vértice colorido decrementa o contador dos vizinhos de prioridade menor; os que
+// chegam a zero formam a próxima fronteira. Vizinhos na mesma fronteira não existem (um deles
+// esperaria pelo outro), e as cores lidas são todas de rodadas anteriores. O resultado é o
+// First Fit na ordem de prioridade decrescente, igual para qualquer número de threads.
+typedef struct {
+    Graph *graph;
+    int *colors;
+    const uint64_t *priority;
+    int *waiting;
+    int *frontier;
+    int frontier_size;
+    int *next;
+    int next_size;          // Atômico: próxima fronteira
+    int cursor;             // Atômico: próximo bloco da rodada
+    ParallelTeam team;
+} JonesPlassmann;
+
+typedef struct {
+    JonesPlassmann *shared;
+    int thread_id;
+    int max_color;
+} JonesPlassmannTask;
+
+// u tem prioridade maior que v (empates, muito raros, pelo menor índice)
+static inline bool jp_before(const uint64_t *priority, int u, int v) {
+    return priority[u] > priority[v] || (priority[u] == priority[v] && u < v);
+}
+
+// Acrescenta os vértices do buffer local à próxima fronteira, reservando espaço de uma vez
+static void jp_flush(JonesPlassmann *jp, int *buffer, int *count) {
+    int start = __atomic_fetch_add(&jp->next_size, *count, __ATOMIC_RELAXED);
+    for (int i = 0; i < *count; i++) {
+        jp->next[start + i] = buffer[i];
+    }
+    *count = 0;
+}
+
+static void *jp_worker(void *arg) {
+    JonesPlassmannTask *task = (JonesPlassmannTask *)arg;
+    JonesPlassmann *jp = task->shared;
+    Graph *graph = jp->graph;
+    int n = graph->num_vertices;
+    int buffer[PARALLEL_CHUNK];
+    int buffered = 0;
+    parallel_team_enter(&jp->team);
+
+    FirstFitScratch scratch;
+    if (!first_fit_init(&scratch, graph_max_degree(graph))) {
+        perror("Erro ao alocar memória para o First Fit no Jones-Plassmann");
+        exit(EXIT_FAILURE);
+    }
+
+    // Contadores iniciais; quem não espera ninguém vai para a primeira fronteira
+    for (;;) {
+        int begin = __atomic_fetch_add(&jp->cursor, PARALLEL_CHUNK, __ATOMIC_RELAXED);
+        if (begin >= n) break;
+        int end = begin + PARALLEL_CHUNK < n ? begin + PARALLEL_CHUNK : n;
+        for (int v = begin; v < end; v++) {
+            int count = 0;
+            int u;
+            for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &u);) {
+                count += jp_before(jp->priority, u, v);
+            }
+            jp->waiting[v] = count;
+            if (count == 0) {
+                buffer[buffered++] = v;
+            }
+        }
+        jp_flush(jp, buffer, &buffered);
+    }
+
+    for (;;) {
+        // Fim da rodada: a thread 0 troca as fronteiras enquanto as outras esperam
+        pthread_barrier_wait(&jp->team.barrier);
+        if (task->thread_id == 0) {
+            int *swap = jp->frontier;
+            jp->frontier = jp->next;
+            jp->next = swap;
+            jp->frontier_size = jp->next_size;
+            jp->next_size = 0;
+            jp->cursor = 0;
+        }
+        pthread_barrier_wait(&jp->team.barrier);
+        if (jp->frontier_size == 0) break;
+
+        for (;;) {
+            int begin = __atomic_fetch_add(&jp->cursor, PARALLEL_CHUNK, __ATOMIC_RELAXED);
+            if (begin >= jp->frontier_size) break;
+            int end = begin + PARALLEL_CHUNK < jp->frontier_size ? begin + PARALLEL_CHUNK : jp->frontier_size;
+            for (int i = begin; i < end; i++) {
+                int v = jp->frontier[i];
+                int color = first_fit_pick(&scratch, graph, jp->colors, v);
+                jp->colors[v] = color;
+                if (color > task->max_color) {
+                    task->max_color = color;
+                }
+                int u;
+                for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &u);) {
+                    if (jp_before(jp->priority, v, u) &&
+                        __atomic_sub_fetch(&jp->waiting[u], 1, __ATOMIC_RELAXED) == 0) {
+                        buffer[buffered++] = u;
+                        if (buffered == PARALLEL_CHUNK) {
+                            jp_flush(jp, buffer, &buffered);
+                        }
+                    }
+                }
+            }
+        }
+        jp_flush(jp, buffer, &buffered);
+    }
+
+    first_fit_free(&scratch);
+    return NULL;
+}
+
+// Implementa o algoritmo Jones-Plassmann (prioridades aleatórias de Luby) com num_threads
+// threads (<= 0: uma por CPU). A coloração depende só de `seed`.
+// graph: Ponteiro para a estrutura Graph.
+// colors: Um array de inteiros (alocado pelo chamador) onde as cores de cada vértice serão armazenadas.
+//         colors[i] conterá a cor do vértice i.
+// Retorna o número total de cores utilizadas.
+int jones_plassmann_coloring(Graph *graph, int *colors, int num_threads, uint64_t seed) {
+    int n = graph->num_vertices;
+    for (int i = 0; i < n; i++) {
+        colors[i] = 0;
+    }
+    if (n == 0) {
+        return 0;
+    }
+    num_threads = parallel_thread_count(num_threads, n);
+    graph_max_degree(graph); // A análise não é thread-safe: calcula antes das threads
+
+    JonesPlassmann jp = { 0 };
+    jp.graph = graph;
+    jp.colors = colors;
+    uint64_t *priority = (uint64_t *)malloc(n * sizeof(uint64_t));
+    jp.waiting = (int *)malloc(n * sizeof(int));
+    jp.frontier = (int *)malloc(n * sizeof(int));
+    jp.next = (int *)malloc(n * sizeof(int));
+    JonesPlassmannTask *tasks = (JonesPlassmannTask *)calloc(num_threads, sizeof(JonesPlassmannTask));
+    if (priority == NULL || jp.waiting == NULL || jp.frontier == NULL || jp.next == NULL || tasks == NULL) {
+        perror("Erro ao alocar memória para o Jones-Plassmann");
+        exit(EXIT_FAILURE);
+    }
+    for (int v = 0; v < n; v++) {
+        priority[v] = vertex_priority(seed, v);
+    }
+    jp.priority = priority;
+
+    for (int t = 0; t < num_threads; t++) {
+        tasks[t].shared = &jp;
+        tasks[t].thread_id = t;
+    }
+    int started = parallel_team_run(&jp.team, jp_worker, tasks, sizeof(JonesPlassmannTask), num_threads);
+
+    int max_colors_used = 0;
+    for (int t = 0; t < started; t++) {
+        if (tasks[t].max_color > max_colors_used) {
+            max_colors_used = tasks[t].max_color;
+        }
+    }
+
+    free(priority);
+    free(jp.waiting);
+    free(jp.frontier);
+    free(jp.next);
+    free(tasks);
+
+    return max_colors_used;
+}
+
+// --- Algoritmo Especulativo (Gebremedhin-Manne) para Coloração de Vértices ---
+
+// Cada iteração colore a lista de trabalho em paralelo com First Fit, sem esperar por ninguém:
+// vizinhos coloridos ao mesmo tempo por threads diferentes podem escolher a mesma cor. Uma
+// segunda passada, também paralela, procura esses conflitos, e dos dois vértices recolore só o
+// que vem depois na ordem. Os conflitos só aparecem entre vértices da mesma iteração (as cores
+// anteriores já estão visíveis depois da barreira), e o primeiro vértice da lista nunca perde
+// a cor, então a lista encolhe a cada iteração. Com uma thread não há conflitos e o resultado
+// é o First Fit sequencial na mesma ordem.
+typedef struct {
+    Graph *graph;
+    int *colors;
+    const int *rank;        // Posição de cada vértice na ordem (NULL: a ordem natural)
+    int *work;              // Vértices a colorir nesta iteração, na ordem dada
+    int work_size;
+    unsigned char *recolor; // recolor[v] != 0: v perdeu o conflito e volta para a lista
+    int cursor;             // Atômico: próximo bloco da fase
+    ParallelTeam team;
+} SpeculativeGreedy;
+
+typedef struct {
+    SpeculativeGreedy *shared;
+    int thread_id;
+} SpeculativeGreedyTask;
+
+// u vem antes de v na ordem
+static inline bool sg_before(const int *rank, int u, int v) {
+    return rank != NULL ? rank[u] < rank[v] : u < v;
+}
+
+// first_fit_pick com leituras atômicas: as cores dos vizinhos mudam enquanto são lidas
+static int sg_pick(FirstFitScratch *scratch, Graph *graph, int *colors, int v) {
+    int u;
+    for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &u);) {
+        first_fit_forbid(scratch, __atomic_load_n(&colors[u], __ATOMIC_RELAXED));
+    }
+    return first_fit_take(scratch);
+}
+
+static void *sg_worker(void *arg) {
+    SpeculativeGreedyTask *task = (SpeculativeGreedyTask *)arg;
+    SpeculativeGreedy *sg = task->shared;
+    Graph *graph = sg->graph;
+    parallel_team_enter(&sg->team);
+
+    FirstFitScratch scratch;
+    if (!first_fit_init(&scratch, graph_max_degree(graph))) {
+        perror("Erro ao alocar memória para o First Fit especulativo");
+        exit(EXIT_FAILURE);
+    }
+
+    while (sg->work_size > 0) {
+        // Fase 1: colorir a lista de trabalho
+        for (;;) {
+            int begin = __atomic_fetch_add(&sg->cursor, PARALLEL_CHUNK, __ATOMIC_RELAXED);
+            if (begin >= sg->work_size) break;
+            int end = begin + PARALLEL_CHUNK < sg->work_size ? begin + PARALLEL_CHUNK : sg->work_size;
+            for (int i = begin; i < end; i++) {
+                int v = sg->work[i];
+                __atomic_store_n(&sg->colors[v], sg_pick(&scratch, graph, sg->colors, v), __ATOMIC_RELAXED);
+            }
+        }
+        pthread_barrier_wait(&sg->team.barrier);
+        if (task->thread_id == 0) {
+            sg->cursor = 0;
+        }
+        pthread_barrier_wait(&sg->team.barrier);
+
+        // Fase 2: marcar quem perde cada conflito (cada v é marcado só pela thread que o visita)
+        for (;;) {
+            int begin = __atomic_fetch_add(&sg->cursor, PARALLEL_CHUNK, __ATOMIC_RELAXED);
+            if (begin >= sg->work_size) break;
+            int end = begin + PARALLEL_CHUNK < sg->work_size ? begin + PARALLEL_CHUNK : sg->work_size;
+            for (int i = begin; i < end; i++) {
+                int v = sg->work[i];
+                int color = sg->colors[v];
+                int u;
+                for (NeighborIter it = graph_neighbors(graph, v); neighbor_next(&it, &u);) {
+                    if (sg->colors[u] == color && sg_before(sg->rank, u, v)) {
+                        sg->recolor[v] = 1;
+                        break;
+                    }
+                }
+            }
+        }
+        pthread_barrier_wait(&sg->team.barrier);
+
+        // Fim da iteração: a thread 0 compacta a lista, mantendo a ordem, enquanto as outras esperam
+        if (task->thread_id == 0) {
+            int size = 0;
+            for (int i = 0; i < sg->work_size; i++) {
+                int v = sg->work[i];
+                if (sg->recolor[v]) {
+                    sg->recolor[v] = 0;
+                    sg->colors[v] = 0;
+                    sg->work[size++] = v;
+                }
+            }
+            sg->work_size = size;
+            sg->cursor = 0;
+        }
+        pthread_barrier_wait(&sg->team.barrier);
+    }
+
+    first_fit_free(&scratch);
+    return NULL;
+}
+
+// Implementa a coloração gulosa especulativa de Gebremedhin-Manne com num_threads threads
+// (<= 0: uma por CPU), na ordem dada (order == NULL: 0, 1, ..., n - 1; ou graph_degree_order,
+// graph_smallest_last_order, ...). O resultado depende de como as threads se intercalam.
+// graph: Ponteiro para a estrutura Graph.
+// colors: Um array de inteiros (alocado pelo chamador) onde as cores de cada vértice serão armazenadas.
+//         colors[i] conterá a cor do vértice i.
+// Retorna o número total de cores utilizadas.
+int speculative_greedy_coloring(Graph *graph, const int *order, int *colors, int num_threads) {
+    int n = graph->num_vertices;
+    for (int i = 0; i < n; i++) {
+        colors[i] = 0;
+    }
+    if (n == 0) {
+        return 0;
+    }
+    num_threads = parallel_thread_count(num_threads, n);
+    graph_max_degree(graph); // A análise não é thread-safe: calcula antes das threads
+
+    SpeculativeGreedy sg = { 0 };
+    sg.graph = graph;
+    sg.colors = colors;
+    sg.work = (int *)malloc(n * sizeof(int));
+    sg.recolor = (unsigned char *)calloc(n, sizeof(unsigned char));
+    int *rank = order != NULL ? (int *)malloc(n * sizeof(int)) : NULL;
+    SpeculativeGreedyTask *tasks = (SpeculativeGreedyTask *)calloc(num_threads, sizeof(SpeculativeGreedyTask));
+    if (sg.work == NULL || sg.recolor == NULL || (order != NULL && rank == NULL) || tasks == NULL) {
+        perror("Erro ao alocar memória para a coloração especulativa");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < n; i++) {
+        sg.work[i] = order != NULL ? order[i] : i;
+        if (rank != NULL) {
+            rank[order[i]] = i;
+        }
+    }
+    sg.rank = rank;
+    sg.work_size = n;
+
+    for (int t = 0; t < num_threads; t++) {
+        tasks[t].shared = &sg;
+        tasks[t].thread_id = t;
+    }
+    parallel_team_run(&sg.team, sg_worker, tasks, sizeof(SpeculativeGreedyTask), num_threads);
+
+    // Um vértice recolorido pode ter deixado de usar a maior cor: conta no resultado final
+    int max_colors_used = 0;
+    for (int v = 0; v < n; v++) {
+        if (colors[v] > max_colors_used) {
+            max_colors_used = colors[v];
+        }
+    }
+
+    free(sg.work);
+    free(sg.recolor);
+    free(rank);
+    free(tasks);
+
+    return max_colors_used;
+}